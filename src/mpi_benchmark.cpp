@@ -1,11 +1,61 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#include <linux/perf_event.h>
 #include <vector>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include <mpi.h>
 #include <boost/mpi.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/mpi/packed_oarchive.hpp>
 #include <boost/mpi/packed_iarchive.hpp>
 #include <benchmark/benchmark.h>
+#include "nested_broadcast.hpp"
+#if defined(OPEN_MPI) && MPI_VERSION < 4
+#include <mpi-ext.h>
+#endif
+
+// Broadcast persistant : MPI-4 standard, ou extension pcollreq d'Open MPI 4.x
+#if MPI_VERSION >= 4
+#define BENCH_BCAST_INIT MPI_Bcast_init
+#elif defined(OMPI_HAVE_MPI_EXT_PCOLLREQ) && OMPI_HAVE_MPI_EXT_PCOLLREQ
+#define BENCH_BCAST_INIT MPIX_Bcast_init
+#endif
+
+// Collectives de voisinage persistantes, même origine
+#if MPI_VERSION >= 4
+#define BENCH_NEIGHBOR_ALLTOALL_INIT MPI_Neighbor_alltoall_init
+#define BENCH_NEIGHBOR_ALLTOALLV_INIT MPI_Neighbor_alltoallv_init
+#elif defined(OMPI_HAVE_MPI_EXT_PCOLLREQ) && OMPI_HAVE_MPI_EXT_PCOLLREQ
+#define BENCH_NEIGHBOR_ALLTOALL_INIT MPIX_Neighbor_alltoall_init
+#define BENCH_NEIGHBOR_ALLTOALLV_INIT MPIX_Neighbor_alltoallv_init
+#endif
 
 // Inner iterations scaled by data size to keep benchmark time reasonable
 #define INNER_ITERATIONS_SMALL   10000
@@ -29,31 +79,217 @@ inline int get_inner_iterations(int base_size) {
 // Variables globales MPI
 static int g_rank = -1;
 static int g_size = 0;
+static int g_thread_level = MPI_THREAD_SINGLE;
+
+// Structs POD de test : 16 octets décrits champ par champ (datatype struct),
+// 64 octets sans description (repli sur un transfert d'octets)
+struct Pod16 {
+    double value;
+    float weight;
+    int id;
+
+    static void mpi_fields(MpiFields& fields) {
+        fields.add(1, offsetof(Pod16, value), MPI_DOUBLE);
+        fields.add(1, offsetof(Pod16, weight), MPI_FLOAT);
+        fields.add(1, offsetof(Pod16, id), MPI_INT);
+    }
+
+    template <class Archive>
+    void serialize(Archive & ar, const unsigned int) {
+        ar & value & weight & id;
+    }
+};
+
+struct Pod64 {
+    double coords[6];
+    int ids[4];
+
+    template <class Archive>
+    void serialize(Archive & ar, const unsigned int) {
+        ar & coords & ids;
+    }
+};
+
+static_assert(sizeof(Pod16) == 16 && sizeof(Pod64) == 64, "unexpected POD padding");
+
+// ============================================================================
+// Allocation des buffers de données (--alloc_mode=...)
+// Les vecteurs internes de VectorOfVectors, les valeurs de FlatVectorOfVectors,
+// les buffers 1D et les buffers de réception réutilisés passent par
+// BufferAllocator. À partir de ALLOC_SPECIAL_MIN_BYTES :
+//   default : tas standard (comportement d'origine)
+//   mpi     : MPI_Alloc_mem (mémoire enregistrée/épinglée par la bibliothèque)
+//   thp     : mmap aligné sur 2 Mo + madvise(MADV_HUGEPAGE)
+//   hugetlb : mmap(MAP_HUGETLB), pages de 2 Mo réservées (repli sur thp au démarrage)
+//   numa    : mmap + mbind(MPOL_BIND) sur le nœud NUMA courant du rank
+// Les modes mmap font le premier accès (first-touch) dans allocate(), donc sur le rank
+// propriétaire. Le mode est fixé au démarrage et ne change plus.
+// ============================================================================
+enum AllocMode {
+    ALLOC_DEFAULT,
+    ALLOC_MPI,
+    ALLOC_THP,
+    ALLOC_HUGETLB,
+    ALLOC_NUMA
+};
+
+static const char* alloc_mode_names[] = {"default", "mpi", "thp", "hugetlb", "numa"};
+static AllocMode g_alloc_mode = ALLOC_DEFAULT;
+
+#define ALLOC_SPECIAL_MIN_BYTES (64 * 1024)  // en dessous : tas standard dans tous les modes
+#define HUGE_PAGE_BYTES (2UL << 20)
+
+static inline void count_alloc(size_t bytes);
+
+static bool special_alloc(size_t bytes) {
+    return g_alloc_mode != ALLOC_DEFAULT && bytes >= ALLOC_SPECIAL_MIN_BYTES;
+}
+
+// Longueur réellement mappée pour `bytes` octets (modes mmap)
+static size_t mapped_length(size_t bytes) {
+    size_t page = g_alloc_mode == ALLOC_NUMA ? static_cast<size_t>(sysconf(_SC_PAGESIZE)) : HUGE_PAGE_BYTES;
+    return (bytes + page - 1) / page * page;
+}
+
+static void* map_buffer(size_t length) {
+    if (g_alloc_mode == ALLOC_HUGETLB) {
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+    if (g_alloc_mode == ALLOC_NUMA) {
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return nullptr;
+        unsigned cpu, node;
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0 && node < 8 * sizeof(unsigned long)) {
+            unsigned long mask = 1UL << node;
+            syscall(SYS_mbind, p, length, MPOL_BIND, &mask, 8 * sizeof(mask), 0);
+        }
+        return p;
+    }
+    // THP : sur-allocation puis découpe pour aligner sur 2 Mo
+    char* raw = static_cast<char*>(mmap(nullptr, length + HUGE_PAGE_BYTES, PROT_READ | PROT_WRITE,
+                                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (raw == MAP_FAILED) return nullptr;
+    char* aligned = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(raw) + HUGE_PAGE_BYTES - 1) & ~(HUGE_PAGE_BYTES - 1));
+    if (aligned > raw) munmap(raw, aligned - raw);
+    munmap(aligned + length, raw + HUGE_PAGE_BYTES - aligned);
+    madvise(aligned, length, MADV_HUGEPAGE);
+    return aligned;
+}
+
+static void* buffer_alloc(size_t bytes) {
+    if (!special_alloc(bytes)) {
+        return ::operator new(bytes);
+    }
+    if (g_alloc_mode == ALLOC_MPI) {
+        // Pas de count_alloc : l'allocation interne de la bibliothèque passe déjà par malloc
+        void* p;
+        MPI_Alloc_mem(bytes, MPI_INFO_NULL, &p);
+        return p;
+    }
+    count_alloc(bytes);
+    size_t length = mapped_length(bytes);
+    char* p = static_cast<char*>(map_buffer(length));
+    if (!p) throw std::bad_alloc();
+    // First-touch par le rank propriétaire
+    for (size_t offset = 0; offset < length; offset += 4096) {
+        p[offset] = 0;
+    }
+    return p;
+}
+
+static void buffer_free(void* p, size_t bytes) {
+    if (!special_alloc(bytes)) {
+        ::operator delete(p);
+        return;
+    }
+    if (g_alloc_mode == ALLOC_MPI) {
+        int finalized;
+        MPI_Finalized(&finalized);
+        if (!finalized) MPI_Free_mem(p);
+        return;
+    }
+    munmap(p, mapped_length(bytes));
+}
+
+// Sélection du mode au démarrage (collectif) ; hugetlb retombe sur thp si aucun
+// rank ne peut obtenir de page de 2 Mo réservée (vm.nr_hugepages à 0)
+static bool select_alloc_mode(const std::string& name) {
+    int mode = -1;
+    for (int m = 0; m <= ALLOC_NUMA; m++) {
+        if (name == alloc_mode_names[m]) mode = m;
+    }
+    if (mode < 0) return false;
+    g_alloc_mode = static_cast<AllocMode>(mode);
+
+    if (g_alloc_mode == ALLOC_HUGETLB) {
+        void* probe = map_buffer(HUGE_PAGE_BYTES);
+        int ok = probe != nullptr, all_ok;
+        if (probe) munmap(probe, HUGE_PAGE_BYTES);
+        MPI_Allreduce(&ok, &all_ok, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+        if (!all_ok) {
+            if (g_rank == 0) {
+                std::cerr << "MAP_HUGETLB unavailable, falling back to --alloc_mode=thp" << std::endl;
+            }
+            g_alloc_mode = ALLOC_THP;
+        }
+    }
+    return true;
+}
+
+template <class T>
+struct BufferAllocator {
+    using value_type = T;
+
+    BufferAllocator() = default;
+    template <class U>
+    BufferAllocator(const BufferAllocator<U>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(buffer_alloc(n * sizeof(T))); }
+    void deallocate(T* p, size_t n) { buffer_free(p, n * sizeof(T)); }
+};
+
+template <class T, class U>
+bool operator==(const BufferAllocator<T>&, const BufferAllocator<U>&) { return true; }
+template <class T, class U>
+bool operator!=(const BufferAllocator<T>&, const BufferAllocator<U>&) { return false; }
+
+template <class T>
+using BufferVector = std::vector<T, BufferAllocator<T>>;
 
-struct VectorOfVectors {
-    std::vector<std::vector<int>> data;
+template <typename T>
+struct BasicVectorOfVectors {
+    std::vector<BufferVector<T>> data;
 
     // Constructeur paramétré : outer_size vecteurs, taille = base_size * (i+1)²
     // Ratio 25:1 entre le plus grand et le plus petit vecteur
-    VectorOfVectors(int outer_size, int base_size) {
+    BasicVectorOfVectors(int outer_size, int base_size) {
         data.resize(outer_size);
         for (int i = 0; i < outer_size; i++) {
             int factor = (i + 1) * (i + 1);  // 1, 4, 9, 16, 25
-            data[i].resize(base_size * factor, 0);
+            data[i].resize(static_cast<size_t>(base_size) * factor, T());
+        }
+    }
+
+    // Forme arbitraire : un vecteur par taille (voir make_ragged_shape)
+    explicit BasicVectorOfVectors(const std::vector<int>& inner_sizes) {
+        data.resize(inner_sizes.size());
+        for (size_t i = 0; i < inner_sizes.size(); i++) {
+            data[i].resize(inner_sizes[i], T());
         }
     }
 
     // Constructeur vide pour réception
-    VectorOfVectors() : data() {}
+    BasicVectorOfVectors() : data() {}
 
     template <class Archive>
     void serialize(Archive & ar, const unsigned int) {
         ar & data;
     }
 
-    // Calcule la taille totale en nombre d'ints
-    int total_elements() const {
-        int total = 0;
+    // Calcule la taille totale en nombre d'éléments (peut dépasser 2^31)
+    long total_elements() const {
+        long total = 0;
         for (const auto& v : data) {
             total += v.size();
         }
@@ -61,6 +297,185 @@ struct VectorOfVectors {
     }
 };
 
+using VectorOfVectors = BasicVectorOfVectors<int>;
+
+// ============================================================================
+// Générateur de formes irrégulières : outer_size tailles de moyenne `mean_size`
+// (total ~= outer_size * mean_size quelle que soit la distribution)
+// ============================================================================
+enum ShapeKind {
+    SHAPE_UNIFORM = 0,    // toutes les tailles = mean_size
+    SHAPE_QUADRATIC = 1,  // motif (i % 5 + 1)² des configurations, ratio 25:1
+    SHAPE_ZIPF = 2,       // loi de puissance (exposant 1.1), ordre mélangé
+    SHAPE_MANY_EMPTY = 3  // 90 % de vecteurs vides, les autres à 10 x mean_size
+};
+
+static const char* const shape_names[] = {"uniform", "quadratic", "zipf", "many_empty"};
+
+static std::vector<int> make_ragged_shape(int outer_size, int mean_size, ShapeKind shape, unsigned seed = 12345) {
+    std::vector<int> sizes(outer_size);
+    std::mt19937 rng(seed);
+    switch (shape) {
+        case SHAPE_UNIFORM:
+            std::fill(sizes.begin(), sizes.end(), mean_size);
+            break;
+        case SHAPE_QUADRATIC:
+            // Moyenne de (k + 1)² sur k = 0..4 : 55 / 5 = 11
+            for (int i = 0; i < outer_size; i++) {
+                int factor = (i % 5 + 1) * (i % 5 + 1);
+                sizes[i] = static_cast<long>(mean_size) * factor / 11;
+            }
+            break;
+        case SHAPE_ZIPF: {
+            double norm = 0.0;
+            for (int i = 0; i < outer_size; i++) {
+                norm += std::pow(i + 1.0, -1.1);
+            }
+            double total = static_cast<double>(outer_size) * mean_size;
+            for (int i = 0; i < outer_size; i++) {
+                sizes[i] = static_cast<int>(std::lround(total * std::pow(i + 1.0, -1.1) / norm));
+            }
+            std::shuffle(sizes.begin(), sizes.end(), rng);
+            break;
+        }
+        case SHAPE_MANY_EMPTY:
+            for (int i = 0; i < outer_size; i++) {
+                sizes[i] = rng() % 10 == 0 ? mean_size * 10 : 0;
+            }
+            break;
+    }
+    return sizes;
+}
+
+// Représentation CSR contiguë : offsets[i]..offsets[i+1] délimite le vecteur i dans values
+// Même forme que VectorOfVectors, mais deux buffers seulement quel que soit outer_size
+struct FlatVectorOfVectors {
+    std::vector<int> offsets;
+    BufferVector<int> values;
+
+    // Vue non-propriétaire sur un vecteur interne (interface proche de std::vector<int>)
+    template <class T>
+    struct RowView {
+        T* ptr;
+        int count;
+
+        T* data() const { return ptr; }
+        int size() const { return count; }
+        bool empty() const { return count == 0; }
+        T* begin() const { return ptr; }
+        T* end() const { return ptr + count; }
+        T& operator[](int k) const { return ptr[k]; }
+    };
+
+    // Même formule que VectorOfVectors : taille = base_size * (i+1)²
+    FlatVectorOfVectors(int outer_size, int base_size) : offsets(outer_size + 1, 0) {
+        for (int i = 0; i < outer_size; i++) {
+            offsets[i + 1] = offsets[i] + base_size * (i + 1) * (i + 1);
+        }
+        values.resize(offsets[outer_size], 0);
+    }
+
+    explicit FlatVectorOfVectors(const VectorOfVectors& vec) : offsets(vec.data.size() + 1, 0) {
+        for (size_t i = 0; i < vec.data.size(); i++) {
+            offsets[i + 1] = offsets[i] + vec.data[i].size();
+        }
+        values.resize(offsets.back());
+        for (size_t i = 0; i < vec.data.size(); i++) {
+            std::copy(vec.data[i].begin(), vec.data[i].end(), values.begin() + offsets[i]);
+        }
+    }
+
+    // Constructeur vide pour réception
+    FlatVectorOfVectors() : offsets(1, 0), values() {}
+
+    // Alloue les buffers de réception à partir de l'en-tête {outer_size, total_elements}
+    void resize(int outer_size, int total) {
+        offsets.resize(outer_size + 1);
+        values.resize(total);
+    }
+
+    int size() const { return offsets.size() - 1; }
+    int total_elements() const { return values.size(); }
+
+    RowView<int> operator[](int i) { return {values.data() + offsets[i], offsets[i + 1] - offsets[i]}; }
+    RowView<const int> operator[](int i) const { return {values.data() + offsets[i], offsets[i + 1] - offsets[i]}; }
+
+    VectorOfVectors to_nested() const {
+        VectorOfVectors vec;
+        vec.data.resize(size());
+        for (int i = 0; i < size(); i++) {
+            vec.data[i].assign((*this)[i].begin(), (*this)[i].end());
+        }
+        return vec;
+    }
+
+    template <class Archive>
+    void serialize(Archive & ar, const unsigned int) {
+        ar & offsets;
+        ar & values;
+    }
+};
+
+// Allocateur sans initialisation par valeur : resize() n'écrit pas de zéros
+template <class T>
+struct default_init_allocator : BufferAllocator<T> {
+    template <class U>
+    struct rebind { using other = default_init_allocator<U>; };
+
+    using BufferAllocator<T>::BufferAllocator;
+
+    template <class U>
+    void construct(U* p) { ::new (static_cast<void*>(p)) U; }
+
+    template <class U, class... Args>
+    void construct(U* p, Args&&... args) { ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+};
+
+// Stockage de réception réutilisé d'une itération à l'autre (pas de zéroïsation)
+struct PooledVectorOfVectors {
+    std::vector<std::vector<int, default_init_allocator<int>>> data;
+
+    template <class Archive>
+    void serialize(Archive & ar, const unsigned int) {
+        ar & data;
+    }
+};
+
+// ============================================================================
+// Modes de stockage côté receveur
+// RECV_FRESH       : recv_vec construit et initialisé à chaque itération (comportement d'origine)
+// RECV_FRESH_TIMED : idem, allocations chronométrées séparément (compteur "alloc_us")
+// RECV_POOLED      : stockage conservé entre itérations, allocateur sans zéroïsation
+// ============================================================================
+enum RecvMode {
+    RECV_FRESH,
+    RECV_FRESH_TIMED,
+    RECV_POOLED
+};
+
+template <RecvMode Mode>
+using RecvVectorOfVectors = std::conditional_t<Mode == RECV_POOLED, PooledVectorOfVectors, VectorOfVectors>;
+
+template <RecvMode Mode>
+using RecvBuffer = std::conditional_t<Mode == RECV_POOLED, std::vector<char, default_init_allocator<char>>, std::vector<char>>;
+
+// Exécute une allocation de réception, chronométrée seulement en mode RECV_FRESH_TIMED
+template <RecvMode Mode>
+struct AllocTimer {
+    double total = 0.0;
+
+    template <class F>
+    void operator()(F&& alloc) {
+        if constexpr (Mode == RECV_FRESH_TIMED) {
+            double t = MPI_Wtime();
+            alloc();
+            total += MPI_Wtime() - t;
+        } else {
+            alloc();
+        }
+    }
+};
+
 // NullReporter pour les ranks > 0
 class NullReporter : public benchmark::BenchmarkReporter {
 public:
@@ -69,18 +484,317 @@ public:
     void Finalize() override {}
 };
 
+// Temps d'allocation moyen par opération (max sur les ranks), en mode RECV_FRESH_TIMED
+template <RecvMode Mode>
+static void SetAllocCounter(benchmark::State& state, const AllocTimer<Mode>& alloc_timer, int inner_iters) {
+    if constexpr (Mode == RECV_FRESH_TIMED) {
+        double per_op = alloc_timer.total / (state.iterations() * inner_iters);
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.counters["alloc_us"] = max_per_op * 1e6;
+    }
+}
+
 // Helper pour créer un nom de benchmark avec la taille
-static void SetBytesProcessed(benchmark::State& state, const VectorOfVectors& vec, int inner_iters) {
+template <typename T>
+static void SetBytesProcessed(benchmark::State& state, const BasicVectorOfVectors<T>& vec, int inner_iters) {
+    state.SetBytesProcessed(state.iterations() * inner_iters * vec.total_elements() * sizeof(T));
+}
+
+static void SetBytesProcessed(benchmark::State& state, const FlatVectorOfVectors& vec, int inner_iters) {
     state.SetBytesProcessed(state.iterations() * inner_iters * vec.total_elements() * sizeof(int));
 }
 
+// ============================================================================
+// Instrumentation mémoire (--memory_counters)
+// - allocations : malloc/calloc/realloc interposés (glibc), ce qui couvre aussi
+//   operator new et les allocations internes de MPI et Boost ; sinon operator new
+// - pic RSS : VmHWM de /proc/self/status, remis à VmRSS via /proc/self/clear_refs
+//   (repli sur ru_maxrss, qui ne se remet pas à zéro)
+// - copies : count_copy() là où une stratégie recopie la charge utile
+//   (pack/unpack, sérialisation, aplatissement), en plus du transfert lui-même
+// ============================================================================
+static bool g_memory_counters = false;
+static std::atomic<long> g_alloc_count{0};
+static std::atomic<long> g_alloc_bytes{0};
+static std::atomic<long> g_copied_bytes{0};
+
+static inline void count_alloc(size_t bytes) {
+    if (g_memory_counters) {
+        g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+        g_alloc_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+static inline void count_copy(long bytes) {
+    if (g_memory_counters) {
+        g_copied_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+    count_alloc(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    count_alloc(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    count_alloc(size);
+    return __libc_realloc(ptr, size);
+}
+}
+#else
+void* operator new(size_t size) {
+    count_alloc(size);
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+#endif
+
+// Valeur en kB d'une ligne de /proc/self/status (VmRSS, VmHWM), -1 si absente
+static long read_status_kb(const char* key) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    size_t key_len = std::strlen(key);
+    while (std::getline(status, line)) {
+        if (line.compare(0, key_len, key) == 0 && line[key_len] == ':') {
+            return std::stol(line.substr(key_len + 1));
+        }
+    }
+    return -1;
+}
+
+// Compteur perf_event du processus (espace utilisateur uniquement, pour rester
+// utilisable avec perf_event_paranoid=2) ; valid() est faux si l'ouverture a échoué.
+class PerfCounter {
+public:
+    PerfCounter(uint32_t type, uint64_t config) {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+    ~PerfCounter() {
+        if (fd_ >= 0) close(fd_);
+    }
+
+    bool valid() const { return fd_ >= 0; }
+
+    void start() {
+        if (fd_ < 0) return;
+        ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    long read_value() const {
+        uint64_t value = 0;
+        if (fd_ < 0 || read(fd_, &value, sizeof(value)) != sizeof(value)) return -1;
+        return static_cast<long>(value);
+    }
+
+private:
+    int fd_ = -1;
+};
+
+// Mesure d'un benchmark :
+//   MemoryProbe memory;   en tête (RSS de référence, pic remis à zéro)
+//   memory.begin_loop();  juste avant la boucle chronométrée
+//   memory.report(...);   après la boucle (collectif)
+// Allocations et copies sont ramenées à une opération ; le pic RSS couvre tout
+// le benchmark, buffers de préparation compris (ex. send_buffer de BM_RDMAMPI).
+// dtlb_misses et page_faults (par opération, max sur les ranks) ne sont publiés
+// que si perf_event_open a réussi sur tous les ranks. Sans --memory_counters,
+// les compteurs perf ne sont pas ouverts.
+class MemoryProbe {
+public:
+    MemoryProbe() {
+        if (!g_memory_counters) return;
+        dtlb_misses_ = std::make_unique<PerfCounter>(
+            PERF_TYPE_HW_CACHE,
+            PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+        page_faults_ = std::make_unique<PerfCounter>(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        clear_refs << "5";
+        clear_refs.close();
+        hwm_reset_ = static_cast<bool>(clear_refs);
+        base_rss_kb_ = hwm_reset_ ? read_status_kb("VmRSS") : max_rss_kb();
+        begin_loop();
+    }
+
+    void begin_loop() {
+        alloc_count_ = g_alloc_count.load();
+        alloc_bytes_ = g_alloc_bytes.load();
+        copied_bytes_ = g_copied_bytes.load();
+        if (dtlb_misses_) dtlb_misses_->start();
+        if (page_faults_) page_faults_->start();
+    }
+
+    // Compteurs *_root pour le rank 0, *_recv pour le maximum sur les autres ranks
+    void report(benchmark::State& state, int inner_iters) const {
+        if (!g_memory_counters) return;
+        double ops = static_cast<double>(state.iterations()) * inner_iters;
+        long peak_kb = hwm_reset_ ? read_status_kb("VmHWM") : max_rss_kb();
+        double local[4] = {
+            static_cast<double>(peak_kb - base_rss_kb_),
+            (g_alloc_count.load() - alloc_count_) / ops,
+            (g_alloc_bytes.load() - alloc_bytes_) / ops,
+            (g_copied_bytes.load() - copied_bytes_) / ops,
+        };
+        double values[8], max_values[8];
+        for (int k = 0; k < 4; k++) {
+            values[k] = g_rank == 0 ? local[k] : 0.0;
+            values[4 + k] = g_rank == 0 ? 0.0 : local[k];
+        }
+        MPI_Allreduce(values, max_values, 8, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+        static const char* names[4] = {"rss_kb", "allocs", "alloc_bytes", "copied_bytes"};
+        for (int k = 0; k < 4; k++) {
+            auto base = k >= 2 ? benchmark::Counter::kIs1024 : benchmark::Counter::kIs1000;
+            state.counters[std::string(names[k]) + "_root"] = benchmark::Counter(max_values[k], benchmark::Counter::kDefaults, base);
+            if (g_size > 1) {
+                state.counters[std::string(names[k]) + "_recv"] = benchmark::Counter(max_values[4 + k], benchmark::Counter::kDefaults, base);
+            }
+        }
+
+        // Compteurs perf : -1 sur un rank qui n'a pas pu les ouvrir
+        long dtlb = dtlb_misses_->read_value();
+        long faults = page_faults_->read_value();
+        double perf[2] = {dtlb < 0 ? -1.0 : dtlb / ops, faults < 0 ? -1.0 : faults / ops};
+        double perf_min[2], perf_max[2];
+        MPI_Allreduce(perf, perf_min, 2, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+        MPI_Allreduce(perf, perf_max, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        if (perf_min[0] >= 0) state.counters["dtlb_misses"] = perf_max[0];
+        if (perf_min[1] >= 0) state.counters["page_faults"] = perf_max[1];
+    }
+
+private:
+    static long max_rss_kb() {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    std::unique_ptr<PerfCounter> dtlb_misses_;
+    std::unique_ptr<PerfCounter> page_faults_;
+    bool hwm_reset_ = false;
+    long base_rss_kb_ = 0;
+    long alloc_count_ = 0;
+    long alloc_bytes_ = 0;
+    long copied_bytes_ = 0;
+};
+
+// ============================================================================
+// Comptes 64 bits (au-delà de 2^31 éléments ou octets)
+// MPI-4 : points d'entrée `_c` (MPI_Count). Sinon : découpage en morceaux de
+// LARGE_COUNT_CHUNK_BYTES, tous postés en non bloquant puis attendus ensemble ;
+// les comptes int des appels MPI-3 restent ainsi loin de INT_MAX, y compris
+// dans les calculs internes en octets de certaines implémentations.
+// ============================================================================
+#define LARGE_COUNT_CHUNK_BYTES (1L << 30)
+
+static MPI_Count large_chunk_elements(MPI_Datatype type) {
+    int type_size;
+    MPI_Type_size(type, &type_size);
+    return std::max<MPI_Count>(1, LARGE_COUNT_CHUNK_BYTES / type_size);
+}
+
+static void large_bcast(void* buffer, MPI_Count count, MPI_Datatype type, int root, MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Bcast_c(buffer, count, type, root, comm);
+#else
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(type, &lb, &extent);
+    MPI_Count chunk = large_chunk_elements(type);
+    RequestWindow window;
+    for (MPI_Count offset = 0; offset < count; offset += chunk) {
+        int n = std::min(chunk, count - offset);
+        MPI_Ibcast(static_cast<char*>(buffer) + offset * extent, n, type, root, comm, window.next());
+    }
+    window.wait_all();
+#endif
+}
+
+static void large_isend(const void* buffer, MPI_Count count, MPI_Datatype type, int dest, int tag, MPI_Comm comm,
+                        RequestWindow& window) {
+#if MPI_VERSION >= 4
+    MPI_Isend_c(buffer, count, type, dest, tag, comm, window.next());
+#else
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(type, &lb, &extent);
+    MPI_Count chunk = large_chunk_elements(type);
+    for (MPI_Count offset = 0; offset < count; offset += chunk) {
+        int n = std::min(chunk, count - offset);
+        MPI_Isend(static_cast<const char*>(buffer) + offset * extent, n, type, dest, tag, comm, window.next());
+    }
+#endif
+}
+
+static void large_irecv(void* buffer, MPI_Count count, MPI_Datatype type, int source, int tag, MPI_Comm comm,
+                        RequestWindow& window) {
+#if MPI_VERSION >= 4
+    MPI_Irecv_c(buffer, count, type, source, tag, comm, window.next());
+#else
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(type, &lb, &extent);
+    MPI_Count chunk = large_chunk_elements(type);
+    for (MPI_Count offset = 0; offset < count; offset += chunk) {
+        int n = std::min(chunk, count - offset);
+        MPI_Irecv(static_cast<char*>(buffer) + offset * extent, n, type, source, tag, comm, window.next());
+    }
+#endif
+}
+
+// Lecture one-sided de `count` éléments depuis le déplacement `target_disp` de la
+// fenêtre (unité de déplacement = étendue de `type`)
+static void large_get(void* buffer, MPI_Count count, MPI_Datatype type, int target, MPI_Aint target_disp, MPI_Win win) {
+#if MPI_VERSION >= 4
+    MPI_Get_c(buffer, count, type, target, target_disp, count, type, win);
+#else
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(type, &lb, &extent);
+    MPI_Count chunk = large_chunk_elements(type);
+    for (MPI_Count offset = 0; offset < count; offset += chunk) {
+        int n = std::min(chunk, count - offset);
+        MPI_Get(static_cast<char*>(buffer) + offset * extent, n, type, target, target_disp + offset, n, type, win);
+    }
+#endif
+}
+
 // ============================================================================
 // Benchmark Raw MPI
 // ============================================================================
+template <RecvMode Mode = RECV_FRESH>
 static void BM_RawMPI(benchmark::State& state) {
     int outer_size_param = state.range(0);
     int base_size_param = state.range(1);
     int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
 
     VectorOfVectors vec(outer_size_param, base_size_param);
     int outer_size = vec.data.size();
@@ -89,29 +803,29 @@ static void BM_RawMPI(benchmark::State& state) {
         inner_sizes[j] = vec.data[j].size();
     }
 
+    RecvVectorOfVectors<Mode> pooled_vec;
+    AllocTimer<Mode> alloc_timer;
+
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
             if (g_rank == 0) {
-                std::vector<MPI_Request> requests;
+                RequestWindow window;
                 for (int dest = 1; dest < g_size; dest++) {
-                    MPI_Request req1, req2;
-                    MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD, &req1);
-                    requests.push_back(req1);
-                    MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD, &req2);
-                    requests.push_back(req2);
+                    MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD, window.next());
+                    MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD, window.next());
                     for (int j = 0; j < outer_size; j++) {
-                        MPI_Request req3;
-                        MPI_Isend(vec.data[j].data(), inner_sizes[j], MPI_INT, dest, 2 + j, MPI_COMM_WORLD, &req3);
-                        requests.push_back(req3);
+                        MPI_Isend(vec.data[j].data(), inner_sizes[j], MPI_INT, dest, TAG_DATA, MPI_COMM_WORLD, window.next());
                     }
                 }
-                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                window.wait_all();
             } else {
-                VectorOfVectors recv_vec;
-                std::vector<MPI_Request> requests;
+                RecvVectorOfVectors<Mode> fresh_vec;
+                auto& recv_vec = Mode == RECV_POOLED ? pooled_vec : fresh_vec;
+                RequestWindow window;
                 int recv_outer_size;
                 MPI_Request req1, req2;
 
@@ -120,16 +834,14 @@ static void BM_RawMPI(benchmark::State& state) {
                 std::vector<int> recv_inner_sizes(recv_outer_size);
 
                 MPI_Irecv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 1, MPI_COMM_WORLD, &req2);
-                recv_vec.data.resize(recv_outer_size);
+                alloc_timer([&] { recv_vec.data.resize(recv_outer_size); });
                 MPI_Wait(&req2, MPI_STATUS_IGNORE);
 
                 for (int j = 0; j < recv_outer_size; j++) {
-                    MPI_Request req;
-                    recv_vec.data[j].resize(recv_inner_sizes[j]);
-                    MPI_Irecv(recv_vec.data[j].data(), recv_inner_sizes[j], MPI_INT, 0, 2 + j, MPI_COMM_WORLD, &req);
-                    requests.push_back(req);
+                    alloc_timer([&] { recv_vec.data[j].resize(recv_inner_sizes[j]); });
+                    MPI_Irecv(recv_vec.data[j].data(), recv_inner_sizes[j], MPI_INT, 0, TAG_DATA, MPI_COMM_WORLD, window.next());
                 }
-                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                window.wait_all();
             }
         }
 
@@ -150,16 +862,20 @@ static void BM_RawMPI(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
+    SetAllocCounter(state, alloc_timer, inner_iters);
+    memory.report(state, inner_iters);
     SetBytesProcessed(state, vec, inner_iters);
 }
 
 // ============================================================================
 // Benchmark Bcast MPI
 // ============================================================================
+template <RecvMode Mode = RECV_FRESH>
 static void BM_BcastMPI(benchmark::State& state) {
     int outer_size_param = state.range(0);
     int base_size_param = state.range(1);
     int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
 
     VectorOfVectors vec(outer_size_param, base_size_param);
     int outer_size = vec.data.size();
@@ -168,6 +884,10 @@ static void BM_BcastMPI(benchmark::State& state) {
         inner_sizes[j] = vec.data[j].size();
     }
 
+    RecvVectorOfVectors<Mode> pooled_vec;
+    AllocTimer<Mode> alloc_timer;
+
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
@@ -177,29 +897,26 @@ static void BM_BcastMPI(benchmark::State& state) {
                 MPI_Bcast(&outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
                 MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, 0, MPI_COMM_WORLD);
 
-                std::vector<MPI_Request> requests;
+                RequestWindow window;
                 for (int j = 0; j < outer_size; j++) {
-                    MPI_Request req;
-                    MPI_Ibcast(vec.data[j].data(), inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD, &req);
-                    requests.push_back(req);
+                    MPI_Ibcast(vec.data[j].data(), inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD, window.next());
                 }
-                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                window.wait_all();
             } else {
-                VectorOfVectors recv_vec;
+                RecvVectorOfVectors<Mode> fresh_vec;
+                auto& recv_vec = Mode == RECV_POOLED ? pooled_vec : fresh_vec;
                 int recv_outer_size;
                 MPI_Bcast(&recv_outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
                 std::vector<int> recv_inner_sizes(recv_outer_size);
                 MPI_Bcast(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, MPI_COMM_WORLD);
 
-                recv_vec.data.resize(recv_outer_size);
-                std::vector<MPI_Request> requests;
+                alloc_timer([&] { recv_vec.data.resize(recv_outer_size); });
+                RequestWindow window;
                 for (int j = 0; j < recv_outer_size; j++) {
-                    recv_vec.data[j].resize(recv_inner_sizes[j]);
-                    MPI_Request req;
-                    MPI_Ibcast(recv_vec.data[j].data(), recv_inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD, &req);
-                    requests.push_back(req);
+                    alloc_timer([&] { recv_vec.data[j].resize(recv_inner_sizes[j]); });
+                    MPI_Ibcast(recv_vec.data[j].data(), recv_inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD, window.next());
                 }
-                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                window.wait_all();
             }
         }
 
@@ -220,33 +937,50 @@ static void BM_BcastMPI(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
+    SetAllocCounter(state, alloc_timer, inner_iters);
+    memory.report(state, inner_iters);
     SetBytesProcessed(state, vec, inner_iters);
 }
 
 // ============================================================================
 // Benchmark Pack MPI
 // ============================================================================
+template <RecvMode Mode = RECV_FRESH>
 static void BM_PackMPI(benchmark::State& state) {
     int outer_size_param = state.range(0);
     int base_size_param = state.range(1);
     int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
 
     VectorOfVectors vec(outer_size_param, base_size_param);
     int outer_size = vec.data.size();
     std::vector<int> inner_sizes(outer_size);
-    int total_elements = 0;
     for (int j = 0; j < outer_size; j++) {
         inner_sizes[j] = vec.data[j].size();
-        total_elements += inner_sizes[j];
     }
 
-    int int_pack_size, sizes_pack_size, data_pack_size;
+    // MPI_Pack/MPI_Unpack avancent une position int : le buffer packé doit tenir sous INT_MAX octets
+    int int_pack_size, sizes_pack_size;
     MPI_Pack_size(1, MPI_INT, MPI_COMM_WORLD, &int_pack_size);
     MPI_Pack_size(outer_size, MPI_INT, MPI_COMM_WORLD, &sizes_pack_size);
-    MPI_Pack_size(total_elements, MPI_INT, MPI_COMM_WORLD, &data_pack_size);
-    int total_size = int_pack_size + sizes_pack_size + data_pack_size;
+    long packed_bytes = int_pack_size + sizes_pack_size;
+    for (int j = 0; j < outer_size; j++) {
+        int data_pack_size;
+        MPI_Pack_size(inner_sizes[j], MPI_INT, MPI_COMM_WORLD, &data_pack_size);
+        packed_bytes += data_pack_size;
+    }
+    if (packed_bytes > std::numeric_limits<int>::max()) {
+        state.SkipWithError("BM_PackMPI: packed size exceeds the int positions of MPI_Pack");
+        return;
+    }
+    int total_size = packed_bytes;
     std::vector<char> buffer(total_size);
 
+    RecvVectorOfVectors<Mode> pooled_vec;
+    RecvBuffer<Mode> pooled_buffer;
+    AllocTimer<Mode> alloc_timer;
+
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
@@ -260,6 +994,7 @@ static void BM_PackMPI(benchmark::State& state) {
                 for (int j = 0; j < outer_size; j++) {
                     MPI_Pack(vec.data[j].data(), inner_sizes[j], MPI_INT, buffer.data(), total_size, &position, MPI_COMM_WORLD);
                 }
+                count_copy(position);
                 MPI_Request req1, req2;
                 MPI_Ibcast(&position, 1, MPI_INT, 0, MPI_COMM_WORLD, &req1);
                 requests.push_back(req1);
@@ -267,12 +1002,15 @@ static void BM_PackMPI(benchmark::State& state) {
                 requests.push_back(req2);
                 MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
             } else {
-                VectorOfVectors recv_vec;
+                RecvVectorOfVectors<Mode> fresh_vec;
+                auto& recv_vec = Mode == RECV_POOLED ? pooled_vec : fresh_vec;
                 int packed_size;
                 MPI_Request req1, req2;
                 MPI_Ibcast(&packed_size, 1, MPI_INT, 0, MPI_COMM_WORLD, &req1);
                 MPI_Wait(&req1, MPI_STATUS_IGNORE);
-                std::vector<char> recv_buffer(packed_size);
+                RecvBuffer<Mode> fresh_buffer;
+                auto& recv_buffer = Mode == RECV_POOLED ? pooled_buffer : fresh_buffer;
+                alloc_timer([&] { recv_buffer.resize(packed_size); });
                 MPI_Ibcast(recv_buffer.data(), packed_size, MPI_PACKED, 0, MPI_COMM_WORLD, &req2);
                 MPI_Wait(&req2, MPI_STATUS_IGNORE);
 
@@ -282,11 +1020,12 @@ static void BM_PackMPI(benchmark::State& state) {
                 std::vector<int> recv_inner_sizes(recv_outer_size);
                 MPI_Unpack(recv_buffer.data(), packed_size, &position, recv_inner_sizes.data(), recv_outer_size, MPI_INT, MPI_COMM_WORLD);
 
-                recv_vec.data.resize(recv_outer_size);
+                alloc_timer([&] { recv_vec.data.resize(recv_outer_size); });
                 for (int j = 0; j < recv_outer_size; j++) {
-                    recv_vec.data[j].resize(recv_inner_sizes[j]);
+                    alloc_timer([&] { recv_vec.data[j].resize(recv_inner_sizes[j]); });
                     MPI_Unpack(recv_buffer.data(), packed_size, &position, recv_vec.data[j].data(), recv_inner_sizes[j], MPI_INT, MPI_COMM_WORLD);
                 }
+                count_copy(packed_size);
             }
         }
 
@@ -307,16 +1046,20 @@ static void BM_PackMPI(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
+    SetAllocCounter(state, alloc_timer, inner_iters);
+    memory.report(state, inner_iters);
     SetBytesProcessed(state, vec, inner_iters);
 }
 
 // ============================================================================
 // Benchmark Datatype MPI
 // ============================================================================
+template <RecvMode Mode = RECV_FRESH>
 static void BM_DatatypeMPI(benchmark::State& state) {
     int outer_size_param = state.range(0);
     int base_size_param = state.range(1);
     int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
 
     VectorOfVectors vec(outer_size_param, base_size_param);
     int outer_size = vec.data.size();
@@ -325,19 +1068,20 @@ static void BM_DatatypeMPI(benchmark::State& state) {
         inner_sizes[j] = vec.data[j].size();
     }
 
+    RecvVectorOfVectors<Mode> pooled_vec;
+    AllocTimer<Mode> alloc_timer;
+
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
             if (g_rank == 0) {
-                std::vector<MPI_Request> requests;
+                RequestWindow window;
                 for (int dest = 1; dest < g_size; dest++) {
-                    MPI_Request req1, req2;
-                    MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD, &req1);
-                    MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD, &req2);
-                    requests.push_back(req1);
-                    requests.push_back(req2);
+                    MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD, window.next());
+                    MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD, window.next());
                 }
 
                 for (int j = 0; j < outer_size; j++) {
@@ -345,27 +1089,26 @@ static void BM_DatatypeMPI(benchmark::State& state) {
                     MPI_Type_contiguous(inner_sizes[j], MPI_INT, &inner_type);
                     MPI_Type_commit(&inner_type);
                     for (int dest = 1; dest < g_size; dest++) {
-                        MPI_Request req;
-                        MPI_Isend(vec.data[j].data(), 1, inner_type, dest, 2 + j, MPI_COMM_WORLD, &req);
-                        requests.push_back(req);
+                        MPI_Isend(vec.data[j].data(), 1, inner_type, dest, TAG_DATA, MPI_COMM_WORLD, window.next());
                     }
                     MPI_Type_free(&inner_type);
                 }
-                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                window.wait_all();
             } else {
-                VectorOfVectors recv_vec;
+                RecvVectorOfVectors<Mode> fresh_vec;
+                auto& recv_vec = Mode == RECV_POOLED ? pooled_vec : fresh_vec;
                 int recv_outer_size;
                 MPI_Recv(&recv_outer_size, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
                 std::vector<int> recv_inner_sizes(recv_outer_size);
                 MPI_Recv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
-                recv_vec.data.resize(recv_outer_size);
+                alloc_timer([&] { recv_vec.data.resize(recv_outer_size); });
                 for (int j = 0; j < recv_outer_size; j++) {
                     MPI_Datatype inner_type;
                     MPI_Type_contiguous(recv_inner_sizes[j], MPI_INT, &inner_type);
                     MPI_Type_commit(&inner_type);
-                    recv_vec.data[j].resize(recv_inner_sizes[j]);
-                    MPI_Recv(recv_vec.data[j].data(), 1, inner_type, 0, 2 + j, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                    alloc_timer([&] { recv_vec.data[j].resize(recv_inner_sizes[j]); });
+                    MPI_Recv(recv_vec.data[j].data(), 1, inner_type, 0, TAG_DATA, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
                     MPI_Type_free(&inner_type);
                 }
             }
@@ -388,43 +1131,253 @@ static void BM_DatatypeMPI(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
+    SetAllocCounter(state, alloc_timer, inner_iters);
+    memory.report(state, inner_iters);
     SetBytesProcessed(state, vec, inner_iters);
 }
 
 // ============================================================================
-// Benchmark RDMA MPI
+// Datatype hindexed unique - toute la structure décrite par un seul type
+// construit sur les adresses absolues des vecteurs internes (envoi depuis MPI_BOTTOM).
+// Le cache est indexé par la signature de forme (tailles internes) ; le type
+// n'est recréé que si la forme ou les adresses des buffers ont changé.
 // ============================================================================
-static void BM_RDMAMPI(benchmark::State& state) {
-    int outer_size_param = state.range(0);
-    int base_size_param = state.range(1);
-    int inner_iters = get_inner_iterations(base_size_param);
-
-    VectorOfVectors vec(outer_size_param, base_size_param);
-    MPI_Win win;
+class HindexedTypeCache {
+public:
+    HindexedTypeCache() = default;
+    HindexedTypeCache(const HindexedTypeCache&) = delete;
+    HindexedTypeCache& operator=(const HindexedTypeCache&) = delete;
 
-    int outer_size = vec.data.size();
-    std::vector<int> inner_sizes(outer_size);
-    int total_elements = 0;
-    for (int j = 0; j < outer_size; j++) {
-        inner_sizes[j] = vec.data[j].size();
-        total_elements += inner_sizes[j];
+    ~HindexedTypeCache() {
+        for (auto& kv : cache_) {
+            MPI_Type_free(&kv.second.type);
+        }
     }
 
-    std::vector<int> send_buffer;
-    std::vector<int> recv_buffer;
-
-    if (g_rank == 0) {
-        send_buffer.resize(total_elements);
-        int offset = 0;
+    MPI_Datatype get(VectorOfVectors& vec, const std::vector<int>& inner_sizes) {
+        int outer_size = inner_sizes.size();
+        std::vector<MPI_Aint> displs(outer_size);
         for (int j = 0; j < outer_size; j++) {
-            std::copy(vec.data[j].begin(), vec.data[j].end(), send_buffer.begin() + offset);
+            MPI_Get_address(vec.data[j].data(), &displs[j]);
+        }
+
+        auto it = cache_.find(inner_sizes);
+        if (it != cache_.end()) {
+            if (it->second.displs == displs) {
+                hits_++;
+                return it->second.type;
+            }
+            MPI_Type_free(&it->second.type);
+            cache_.erase(it);
+        }
+
+        misses_++;
+        Entry entry{displs, MPI_DATATYPE_NULL};
+        MPI_Type_create_hindexed(outer_size, inner_sizes.data(), displs.data(), MPI_INT, &entry.type);
+        MPI_Type_commit(&entry.type);
+        return cache_.emplace(inner_sizes, std::move(entry)).first->second.type;
+    }
+
+    long hits() const { return hits_; }
+    long misses() const { return misses_; }
+
+private:
+    struct Entry {
+        std::vector<MPI_Aint> displs;
+        MPI_Datatype type;
+    };
+    std::map<std::vector<int>, Entry> cache_;
+    long hits_ = 0;
+    long misses_ = 0;
+};
+
+static void SetTypeCacheCounters(benchmark::State& state, const HindexedTypeCache& cache) {
+    state.counters["type_cache_hits"] = cache.hits();
+    state.counters["type_cache_misses"] = cache.misses();
+}
+
+// ============================================================================
+// Benchmark Hindexed MPI - un seul MPI_Bcast depuis MPI_BOTTOM
+// Les receveurs conservent recv_vec d'une itération à l'autre (les adresses
+// doivent rester stables pour que le type en cache soit réutilisable).
+// ============================================================================
+static void BM_HindexedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    HindexedTypeCache type_cache;
+    VectorOfVectors recv_vec;
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                MPI_Bcast(&outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+                MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+                MPI_Datatype type = type_cache.get(vec, inner_sizes);
+                MPI_Bcast(MPI_BOTTOM, 1, type, 0, MPI_COMM_WORLD);
+            } else {
+                int recv_outer_size;
+                MPI_Bcast(&recv_outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+                std::vector<int> recv_inner_sizes(recv_outer_size);
+                MPI_Bcast(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+                recv_vec.data.resize(recv_outer_size);
+                for (int j = 0; j < recv_outer_size; j++) {
+                    recv_vec.data[j].resize(recv_inner_sizes[j]);
+                }
+                MPI_Datatype type = type_cache.get(recv_vec, recv_inner_sizes);
+                MPI_Bcast(MPI_BOTTOM, 1, type, 0, MPI_COMM_WORLD);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetTypeCacheCounters(state, type_cache);
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Hindexed Raw MPI - un seul MPI_Isend par destination depuis MPI_BOTTOM
+// ============================================================================
+static void BM_HindexedRawMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    HindexedTypeCache type_cache;
+    VectorOfVectors recv_vec;
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                MPI_Datatype type = type_cache.get(vec, inner_sizes);
+                std::vector<MPI_Request> requests;
+                for (int dest = 1; dest < g_size; dest++) {
+                    MPI_Request req1, req2, req3;
+                    MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD, &req1);
+                    MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD, &req2);
+                    MPI_Isend(MPI_BOTTOM, 1, type, dest, 2, MPI_COMM_WORLD, &req3);
+                    requests.push_back(req1);
+                    requests.push_back(req2);
+                    requests.push_back(req3);
+                }
+                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+            } else {
+                int recv_outer_size;
+                MPI_Recv(&recv_outer_size, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                std::vector<int> recv_inner_sizes(recv_outer_size);
+                MPI_Recv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+                recv_vec.data.resize(recv_outer_size);
+                for (int j = 0; j < recv_outer_size; j++) {
+                    recv_vec.data[j].resize(recv_inner_sizes[j]);
+                }
+                MPI_Datatype type = type_cache.get(recv_vec, recv_inner_sizes);
+                MPI_Recv(MPI_BOTTOM, 1, type, 0, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetTypeCacheCounters(state, type_cache);
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark RDMA MPI
+// ============================================================================
+static void BM_RDMAMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    MPI_Win win;
+
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    long total_elements = 0;
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+        total_elements += inner_sizes[j];
+    }
+
+    BufferVector<int> send_buffer;
+    BufferVector<int> recv_buffer;
+
+    if (g_rank == 0) {
+        send_buffer.resize(total_elements);
+        long offset = 0;
+        for (int j = 0; j < outer_size; j++) {
+            std::copy(vec.data[j].begin(), vec.data[j].end(), send_buffer.begin() + offset);
             offset += inner_sizes[j];
         }
-        MPI_Win_create(send_buffer.data(), total_elements * sizeof(int), sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
+        MPI_Win_create(send_buffer.data(), static_cast<MPI_Aint>(total_elements) * sizeof(int), sizeof(int), MPI_INFO_NULL,
+                       MPI_COMM_WORLD, &win);
     } else {
         MPI_Win_create(nullptr, 0, sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
     }
 
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
@@ -444,7 +1397,7 @@ static void BM_RDMAMPI(benchmark::State& state) {
                 std::vector<int> recv_inner_sizes(recv_outer_size);
                 MPI_Recv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
-                int recv_total = 0;
+                long recv_total = 0;
                 for (int j = 0; j < recv_outer_size; j++) {
                     recv_total += recv_inner_sizes[j];
                 }
@@ -453,15 +1406,16 @@ static void BM_RDMAMPI(benchmark::State& state) {
                 recv_vec.data.resize(recv_outer_size);
 
                 MPI_Win_fence(0, win);
-                MPI_Get(recv_buffer.data(), recv_total, MPI_INT, 0, 0, recv_total, MPI_INT, win);
+                large_get(recv_buffer.data(), recv_total, MPI_INT, 0, 0, win);
                 MPI_Win_fence(0, win);
 
-                int offset = 0;
+                long offset = 0;
                 for (int j = 0; j < recv_outer_size; j++) {
                     recv_vec.data[j].resize(recv_inner_sizes[j]);
                     std::copy(recv_buffer.begin() + offset, recv_buffer.begin() + offset + recv_inner_sizes[j], recv_vec.data[j].begin());
                     offset += recv_inner_sizes[j];
                 }
+                count_copy(static_cast<long>(recv_total) * sizeof(int));
             }
         }
 
@@ -484,32 +1438,3441 @@ static void BM_RDMAMPI(benchmark::State& state) {
     }
 
     MPI_Win_free(&win);
+    memory.report(state, inner_iters);
     SetBytesProcessed(state, vec, inner_iters);
 }
 
 // ============================================================================
 // Benchmark Boost MPI
 // ============================================================================
+template <RecvMode Mode = RECV_FRESH>
 static void BM_BoostMPI(benchmark::State& state) {
     int outer_size_param = state.range(0);
     int base_size_param = state.range(1);
     int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    boost::mpi::communicator world;
+    VectorOfVectors vec(outer_size_param, base_size_param);
+
+    // Les allocations ont lieu dans la désérialisation : pas de chronométrage séparé
+    static_assert(Mode != RECV_FRESH_TIMED, "BM_BoostMPI cannot time allocations separately");
+    RecvVectorOfVectors<Mode> pooled_vec;
+    AllocTimer<Mode> alloc_timer;
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                // Sérialisation complète dans une archive pour chaque destination
+                for (int dest = 1; dest < g_size; dest++) {
+                    world.send(dest, 0, vec);
+                    count_copy(vec.total_elements() * sizeof(int));
+                }
+            } else {
+                RecvVectorOfVectors<Mode> fresh_vec;
+                auto& recv_vec = Mode == RECV_POOLED ? pooled_vec : fresh_vec;
+                world.recv(0, 0, recv_vec);
+                count_copy(vec.total_elements() * sizeof(int));
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                world.recv(dest, 1, ack);
+            }
+        } else {
+            int ack = 1;
+            world.send(0, 1, ack);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetAllocCounter(state, alloc_timer, inner_iters);
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Boost Packed MPI
+// ============================================================================
+static void BM_BoostPackedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    boost::mpi::communicator world;
+    VectorOfVectors vec(outer_size_param, base_size_param);
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                boost::mpi::packed_oarchive::buffer_type buffer;
+                boost::mpi::packed_oarchive oa(world, buffer);
+                oa << vec;
+                count_copy(buffer.size());
+                for (int dest = 1; dest < g_size; dest++) {
+                    world.send(dest, 0, buffer);
+                }
+            } else {
+                VectorOfVectors recv_vec;
+                world.recv(0, 0, recv_vec);
+                count_copy(vec.total_elements() * sizeof(int));
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                world.recv(dest, 1, ack);
+            }
+        } else {
+            int ack = 1;
+            world.send(0, 1, ack);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Variantes Boost.MPI avec archive explicite
+// broadcast(world, vec, root) et isend(dest, tag, vec) sérialisent dans un
+// packed_oarchive puis transfèrent l'archive ; on fait ici la même chose en
+// séparant sérialisation (root), transport et désérialisation (receveurs).
+// - *_FRESH  : archives et recv_vec recréés à chaque opération (comme l'API)
+// - *_REUSED : buffers d'archive et recv_vec conservés, capacité réutilisée
+// Les receveurs isend_* postent world.irecv(0, tag, recv_vec) puis wait_all :
+// Boost reçoit la taille puis l'archive (deux phases) et désérialise à la
+// complétion, transport et désérialisation ne sont donc mesurés qu'ensemble.
+// La boucle chronométrée n'exécute que les opérations. Les phases viennent d'une
+// passe non chronométrée de inner_iters opérations où une barrière sépare
+// sérialisation et transport (sinon l'attente des receveurs inclurait la
+// sérialisation du root).
+// ============================================================================
+enum BoostVariant {
+    BOOST_BCAST_FRESH = 0,   // boost::mpi::broadcast de l'archive
+    BOOST_BCAST_REUSED = 1,
+    BOOST_ISEND_FRESH = 2,   // world.isend de l'archive vers chaque rank + wait_all
+    BOOST_ISEND_REUSED = 3
+};
+
+static const char* boost_variant_names[] = {"bcast_fresh", "bcast_reused", "isend_fresh", "isend_reused"};
+
+// Temps cumulés par phase (passe de profilage)
+struct BoostPhaseTimes {
+    double serialize = 0.0;
+    double transport = 0.0;
+    double deserialize = 0.0;
+    double recv = 0.0;  // irecv + wait_all des receveurs isend_* (transport et désérialisation)
+};
+
+// ============================================================================
+// Benchmark Boost Archive MPI
+// ============================================================================
+static void BM_BoostArchiveMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    BoostVariant variant = static_cast<BoostVariant>(state.range(2));
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    boost::mpi::communicator world;
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    bool reuse = variant == BOOST_BCAST_REUSED || variant == BOOST_ISEND_REUSED;
+    bool bcast = variant == BOOST_BCAST_FRESH || variant == BOOST_BCAST_REUSED;
+    state.SetLabel(boost_variant_names[variant]);
+
+    boost::mpi::packed_oarchive::buffer_type out_buffer;
+    boost::mpi::packed_iarchive::buffer_type in_buffer;
+    VectorOfVectors pooled_vec;
+    long archive_bytes = 0;
+
+    // Une opération ; avec `phases`, barrière entre sérialisation et transport et temps par phase
+    auto run_op = [&](BoostPhaseTimes* phases) {
+        if (g_rank == 0) {
+            double t0 = MPI_Wtime();
+            boost::mpi::packed_oarchive::buffer_type fresh_buffer;
+            auto& buffer = reuse ? out_buffer : fresh_buffer;
+            buffer.clear();
+            boost::mpi::packed_oarchive oa(world, buffer);
+            oa << vec;
+            double t1 = MPI_Wtime();
+            if (phases) MPI_Barrier(MPI_COMM_WORLD);
+            double t2 = MPI_Wtime();
+            if (bcast) {
+                boost::mpi::broadcast(world, oa, 0);
+            } else {
+                std::vector<boost::mpi::request> requests;
+                for (int dest = 1; dest < g_size; dest++) {
+                    requests.push_back(world.isend(dest, 0, oa));
+                }
+                boost::mpi::wait_all(requests.begin(), requests.end());
+            }
+            double t3 = MPI_Wtime();
+            if (phases) {
+                phases->serialize += t1 - t0;
+                phases->transport += t3 - t2;
+            } else {
+                archive_bytes = oa.size();
+                count_copy(oa.size());
+            }
+            return;
+        }
+
+        if (phases) MPI_Barrier(MPI_COMM_WORLD);
+        double t0 = MPI_Wtime();
+        VectorOfVectors fresh_vec;
+        auto& recv_vec = reuse ? pooled_vec : fresh_vec;
+        if (bcast) {
+            boost::mpi::packed_iarchive::buffer_type fresh_buffer;
+            boost::mpi::packed_iarchive ia(world, reuse ? in_buffer : fresh_buffer);
+            boost::mpi::broadcast(world, ia, 0);
+            double t1 = MPI_Wtime();
+            ia >> recv_vec;
+            double t2 = MPI_Wtime();
+            if (phases) {
+                phases->transport += t1 - t0;
+                phases->deserialize += t2 - t1;
+            }
+        } else {
+            boost::mpi::request request = world.irecv(0, 0, recv_vec);
+            boost::mpi::wait_all(&request, &request + 1);
+            if (phases) phases->recv += MPI_Wtime() - t0;
+        }
+        if (!phases) count_copy(recv_vec.total_elements() * sizeof(int));
+    };
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            run_op(nullptr);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+
+    // Passe de profilage hors chronométrage ; par opération, maximum sur les ranks
+    BoostPhaseTimes phases;
+    MPI_Barrier(MPI_COMM_WORLD);
+    for (int iter = 0; iter < inner_iters; iter++) {
+        run_op(&phases);
+    }
+    double local[4] = {phases.serialize / inner_iters, phases.transport / inner_iters,
+                       phases.deserialize / inner_iters, phases.recv / inner_iters};
+    double max_phases[4];
+    MPI_Allreduce(local, max_phases, 4, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    state.counters["serialize_us"] = max_phases[0] * 1e6;
+    state.counters["transport_us"] = max_phases[1] * 1e6;
+    if (bcast) {
+        state.counters["deserialize_us"] = max_phases[2] * 1e6;
+    } else {
+        state.counters["recv_us"] = max_phases[3] * 1e6;
+    }
+    state.counters["archive_bytes"] = benchmark::Counter(archive_bytes, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Archives bit à bit pour conteneurs de types trivialement copiables
+// Compatibles avec les fonctions serialize() existantes (`ar & data`) :
+// - std::vector<T> : taille (uint64) puis tableau ; si T est trivialement
+//   copiable, le tableau est copié d'un bloc, sinon élément par élément
+// - types trivialement copiables : octets bruts
+// - autres classes : serialize() via boost::serialization::serialize_adl
+// Deux modes :
+// - bulk : tout est copié dans un buffer fourni (et réutilisé) par l'appelant
+// - segments : scalaires et petits tableaux (< BITWISE_MIN_SEGMENT_BYTES) dans
+//   l'en-tête, les autres tableaux enregistrés comme segments (adresse, octets)
+//   transférés sans copie par un MPI_Type_create_hindexed depuis MPI_BOTTOM.
+//   Côté réception, la désérialisation de l'en-tête dimensionne les conteneurs
+//   et enregistre les segments de destination avant la réception des données.
+// La forme ne doit pas dépendre du contenu des tableaux (vrai pour les conteneurs).
+// ============================================================================
+#define BITWISE_MIN_SEGMENT_BYTES 1024
+
+struct BitwiseSegment {
+    void* address;
+    size_t bytes;
+};
+
+class BitwiseOArchive {
+public:
+    typedef boost::mpl::false_ is_loading;
+    typedef boost::mpl::true_ is_saving;
+
+    // segments == nullptr : mode bulk
+    explicit BitwiseOArchive(std::vector<char>& header, std::vector<BitwiseSegment>* segments = nullptr)
+        : header_(header), segments_(segments) {}
+
+    template <class T>
+    BitwiseOArchive& operator<<(const T& t) {
+        save(t);
+        return *this;
+    }
+
+    template <class T>
+    BitwiseOArchive& operator&(const T& t) {
+        return *this << t;
+    }
+
+    template <class T>
+    void register_type(const T* = nullptr) {}
+
+    unsigned int get_library_version() const { return 0; }
+
+private:
+    template <class T, class A>
+    void save(const std::vector<T, A>& v) {
+        uint64_t count = v.size();
+        write(&count, sizeof(count));
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            size_t bytes = v.size() * sizeof(T);
+            if (segments_ && bytes >= BITWISE_MIN_SEGMENT_BYTES) {
+                segments_->push_back({const_cast<T*>(v.data()), bytes});
+            } else {
+                write(v.data(), bytes);
+            }
+        } else {
+            for (const T& item : v) {
+                save(item);
+            }
+        }
+    }
+
+    template <class T>
+    void save(const T& t) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            write(&t, sizeof(T));
+        } else {
+            boost::serialization::serialize_adl(*this, const_cast<T&>(t), 0);
+        }
+    }
+
+    void write(const void* data, size_t bytes) {
+        size_t position = header_.size();
+        header_.resize(position + bytes);
+        std::memcpy(header_.data() + position, data, bytes);
+        count_copy(bytes);
+    }
+
+    std::vector<char>& header_;
+    std::vector<BitwiseSegment>* segments_;
+};
+
+class BitwiseIArchive {
+public:
+    typedef boost::mpl::true_ is_loading;
+    typedef boost::mpl::false_ is_saving;
+
+    // segments == nullptr : mode bulk
+    BitwiseIArchive(const char* header, size_t size, std::vector<BitwiseSegment>* segments = nullptr)
+        : header_(header), size_(size), segments_(segments) {}
+
+    template <class T>
+    BitwiseIArchive& operator>>(T& t) {
+        load(t);
+        return *this;
+    }
+
+    template <class T>
+    BitwiseIArchive& operator&(T& t) {
+        return *this >> t;
+    }
+
+    template <class T>
+    void register_type(const T* = nullptr) {}
+
+    unsigned int get_library_version() const { return 0; }
+
+private:
+    template <class T, class A>
+    void load(std::vector<T, A>& v) {
+        uint64_t count;
+        read(&count, sizeof(count));
+        v.resize(count);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            size_t bytes = v.size() * sizeof(T);
+            if (segments_ && bytes >= BITWISE_MIN_SEGMENT_BYTES) {
+                segments_->push_back({v.data(), bytes});
+            } else {
+                read(v.data(), bytes);
+            }
+        } else {
+            for (T& item : v) {
+                load(item);
+            }
+        }
+    }
+
+    template <class T>
+    void load(T& t) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            read(&t, sizeof(T));
+        } else {
+            boost::serialization::serialize_adl(*this, t, 0);
+        }
+    }
+
+    void read(void* data, size_t bytes) {
+        if (position_ + bytes > size_) {
+            throw std::runtime_error("BitwiseIArchive: read past the end of the header");
+        }
+        std::memcpy(data, header_ + position_, bytes);
+        position_ += bytes;
+        count_copy(bytes);
+    }
+
+    const char* header_;
+    size_t size_;
+    size_t position_ = 0;
+    std::vector<BitwiseSegment>* segments_;
+};
+
+// Datatype hindexed (MPI_BYTE, adresses absolues) couvrant les segments
+static MPI_Datatype bitwise_segments_type(const std::vector<BitwiseSegment>& segments) {
+    std::vector<int> blocklens(segments.size());
+    std::vector<MPI_Aint> displs(segments.size());
+    for (size_t i = 0; i < segments.size(); i++) {
+        blocklens[i] = segments[i].bytes;
+        MPI_Get_address(segments[i].address, &displs[i]);
+    }
+    MPI_Datatype type;
+    MPI_Type_create_hindexed(segments.size(), blocklens.data(), displs.data(), MPI_BYTE, &type);
+    MPI_Type_commit(&type);
+    return type;
+}
+
+enum BitwiseMode {
+    BITWISE_BULK = 0,
+    BITWISE_SEGMENTS = 1
+};
+
+static const char* bitwise_mode_names[] = {"bulk", "segments"};
+
+// Broadcast d'un objet sérialisable par les archives bit à bit. `header` et
+// `segments` appartiennent à l'appelant et gardent leur capacité d'un appel à l'autre.
+template <class T>
+static void bitwise_bcast(MPI_Comm comm, T& obj, int root, BitwiseMode mode, std::vector<char>& header,
+                          std::vector<BitwiseSegment>& segments) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    std::vector<BitwiseSegment>* recorded = mode == BITWISE_SEGMENTS ? &segments : nullptr;
+    segments.clear();
+
+    long header_size;
+    if (rank == root) {
+        header.clear();
+        BitwiseOArchive oa(header, recorded);
+        oa << obj;
+        header_size = header.size();
+        MPI_Bcast(&header_size, 1, MPI_LONG, root, comm);
+        MPI_Bcast(header.data(), header_size, MPI_BYTE, root, comm);
+    } else {
+        MPI_Bcast(&header_size, 1, MPI_LONG, root, comm);
+        header.resize(header_size);
+        MPI_Bcast(header.data(), header_size, MPI_BYTE, root, comm);
+        BitwiseIArchive ia(header.data(), header_size, recorded);
+        ia >> obj;
+    }
+
+    // Même liste de segments des deux côtés : elle ne dépend que de l'en-tête
+    if (!segments.empty()) {
+        MPI_Datatype type = bitwise_segments_type(segments);
+        MPI_Bcast(MPI_BOTTOM, 1, type, root, comm);
+        MPI_Type_free(&type);
+    }
+}
+
+// ============================================================================
+// Benchmark Bitwise Archive MPI - VectorOfVectors::serialize inchangé,
+// archives bit à bit à la place de packed_oarchive/packed_iarchive
+// ============================================================================
+static void BM_BitwiseArchiveMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    BitwiseMode mode = static_cast<BitwiseMode>(state.range(2));
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    state.SetLabel(bitwise_mode_names[mode]);
+    std::vector<char> header;
+    std::vector<BitwiseSegment> segments;
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                bitwise_bcast(MPI_COMM_WORLD, vec, 0, mode, header, segments);
+            } else {
+                VectorOfVectors recv_vec;
+                bitwise_bcast(MPI_COMM_WORLD, recv_vec, 0, mode, header, segments);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    state.counters["header_bytes"] = benchmark::Counter(header.size(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.counters["segments"] = segments.size();
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Flat CSR MPI - offsets + values broadcastés sans copie
+// ============================================================================
+static void BM_FlatCSRMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    FlatVectorOfVectors vec(outer_size_param, base_size_param);
+    int header[2] = {vec.size(), vec.total_elements()};
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                MPI_Bcast(header, 2, MPI_INT, 0, MPI_COMM_WORLD);
+
+                MPI_Request requests[2];
+                MPI_Ibcast(vec.offsets.data(), header[0] + 1, MPI_INT, 0, MPI_COMM_WORLD, &requests[0]);
+                MPI_Ibcast(vec.values.data(), header[1], MPI_INT, 0, MPI_COMM_WORLD, &requests[1]);
+                MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+            } else {
+                FlatVectorOfVectors recv_vec;
+                int recv_header[2];
+                MPI_Bcast(recv_header, 2, MPI_INT, 0, MPI_COMM_WORLD);
+                recv_vec.resize(recv_header[0], recv_header[1]);
+
+                MPI_Request requests[2];
+                MPI_Ibcast(recv_vec.offsets.data(), recv_header[0] + 1, MPI_INT, 0, MPI_COMM_WORLD, &requests[0]);
+                MPI_Ibcast(recv_vec.values.data(), recv_header[1], MPI_INT, 0, MPI_COMM_WORLD, &requests[1]);
+                MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Flat CSR Raw MPI - offsets + values en point-à-point sans copie
+// ============================================================================
+static void BM_FlatCSRRawMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    FlatVectorOfVectors vec(outer_size_param, base_size_param);
+    int header[2] = {vec.size(), vec.total_elements()};
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                std::vector<MPI_Request> requests;
+                for (int dest = 1; dest < g_size; dest++) {
+                    MPI_Request req1, req2, req3;
+                    MPI_Isend(header, 2, MPI_INT, dest, 0, MPI_COMM_WORLD, &req1);
+                    MPI_Isend(vec.offsets.data(), header[0] + 1, MPI_INT, dest, 1, MPI_COMM_WORLD, &req2);
+                    MPI_Isend(vec.values.data(), header[1], MPI_INT, dest, 2, MPI_COMM_WORLD, &req3);
+                    requests.push_back(req1);
+                    requests.push_back(req2);
+                    requests.push_back(req3);
+                }
+                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+            } else {
+                FlatVectorOfVectors recv_vec;
+                int recv_header[2];
+                MPI_Recv(recv_header, 2, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                recv_vec.resize(recv_header[0], recv_header[1]);
+
+                MPI_Request requests[2];
+                MPI_Irecv(recv_vec.offsets.data(), recv_header[0] + 1, MPI_INT, 0, 1, MPI_COMM_WORLD, &requests[0]);
+                MPI_Irecv(recv_vec.values.data(), recv_header[1], MPI_INT, 0, 2, MPI_COMM_WORLD, &requests[1]);
+                MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Shared Memory MPI - MPI_Win_allocate_shared sur le noeud
+// Le root écrit une seule fois la structure dans le segment partagé
+// (en-tête outer_size + offsets CSR, puis values) ; les autres ranks la
+// lisent sur place via MPI_Win_shared_query.
+// Args: {outer_size, base_size, mode}
+// ============================================================================
+enum SharedMemMode {
+    SHM_MAP = 0,   // les receveurs construisent seulement des vues sur le segment
+    SHM_READ = 1,  // les receveurs lisent toutes les valeurs sur place
+    SHM_COPY = 2   // les receveurs copient dans leur propre VectorOfVectors
+};
+
+static void BM_SharedMemMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int mode = state.range(2);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    long total_elements = vec.total_elements();
+
+    // Tous les ranks doivent partager la mémoire du root
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, g_rank, MPI_INFO_NULL, &node_comm);
+    int node_size;
+    MPI_Comm_size(node_comm, &node_size);
+    int all_on_node = node_size == g_size;
+    MPI_Allreduce(MPI_IN_PLACE, &all_on_node, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+    if (!all_on_node) {
+        MPI_Comm_free(&node_comm);
+        state.SkipWithError("BM_SharedMemMPI requires all ranks on a single node");
+        return;
+    }
+
+    // Segment : [outer_size][offsets (outer_size + 1)][values (total_elements)]
+    MPI_Aint segment_size = g_rank == 0 ? (MPI_Aint)(2 + outer_size + total_elements) * sizeof(int) : 0;
+    int* segment;
+    MPI_Win win;
+    MPI_Win_allocate_shared(segment_size, sizeof(int), MPI_INFO_NULL, node_comm, &segment, &win);
+    if (g_rank != 0) {
+        MPI_Aint root_size;
+        int disp_unit;
+        MPI_Win_shared_query(win, 0, &root_size, &disp_unit, &segment);
+    }
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                int* offsets = segment + 1;
+                int* values = offsets + outer_size + 1;
+                segment[0] = outer_size;
+                offsets[0] = 0;
+                for (int j = 0; j < outer_size; j++) {
+                    std::copy(vec.data[j].begin(), vec.data[j].end(), values + offsets[j]);
+                    offsets[j + 1] = offsets[j] + vec.data[j].size();
+                }
+                MPI_Win_sync(win);
+                MPI_Barrier(node_comm);
+            } else {
+                MPI_Barrier(node_comm);
+                MPI_Win_sync(win);
+
+                int recv_outer_size = segment[0];
+                const int* offsets = segment + 1;
+                const int* values = offsets + recv_outer_size + 1;
+                if (mode == SHM_COPY) {
+                    VectorOfVectors recv_vec;
+                    recv_vec.data.resize(recv_outer_size);
+                    for (int j = 0; j < recv_outer_size; j++) {
+                        recv_vec.data[j].assign(values + offsets[j], values + offsets[j + 1]);
+                    }
+                    benchmark::DoNotOptimize(recv_vec.data.data());
+                } else {
+                    std::vector<FlatVectorOfVectors::RowView<const int>> rows(recv_outer_size);
+                    for (int j = 0; j < recv_outer_size; j++) {
+                        rows[j] = {values + offsets[j], offsets[j + 1] - offsets[j]};
+                    }
+                    if (mode == SHM_READ) {
+                        long long sum = 0;
+                        for (const auto& row : rows) {
+                            for (int v : row) {
+                                sum += v;
+                            }
+                        }
+                        benchmark::DoNotOptimize(sum);
+                    }
+                    benchmark::DoNotOptimize(rows.data());
+                }
+            }
+            // Le root ne réécrit pas le segment tant que les lecteurs n'ont pas fini
+            MPI_Barrier(node_comm);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+    MPI_Comm_free(&node_comm);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmarks 1D - Mesure du coût de communication pur (buffer contigu)
+// ============================================================================
+
+// Helper pour obtenir les inner iterations pour 1D basé sur la taille du tableau
+// Tailles équivalentes aux benchmarks 2D (base_size * 55)
+inline int get_inner_iterations_1d(int64_t array_size) {
+    if (array_size <= 2750) return INNER_ITERATIONS_SMALL;        // ~11 KB
+    if (array_size <= 27500) return INNER_ITERATIONS_MEDIUM;      // ~107 KB
+    if (array_size <= 275000) return INNER_ITERATIONS_LARGE;      // ~1 MB
+    if (array_size <= 2750000) return INNER_ITERATIONS_XLARGE;    // ~10 MB
+    if (array_size <= 27500000) return INNER_ITERATIONS_XXLARGE;  // ~105 MB
+    return INNER_ITERATIONS_XXXLARGE;                              // ~420 MB
+}
+
+// Helper pour SetBytesProcessed pour 1D
+static void SetBytesProcessed1D(benchmark::State& state, int64_t array_size, int inner_iters) {
+    state.SetBytesProcessed(state.iterations() * inner_iters * array_size * sizeof(int));
+}
+
+// ============================================================================
+// Benchmark Raw MPI 1D - Point-to-point avec buffer contigu
+// ============================================================================
+static void BM_RawMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
+    MemoryProbe memory;
+
+    BufferVector<int> send_buffer(array_size, 42);
+    BufferVector<int> recv_buffer(array_size);
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                std::vector<MPI_Request> requests(g_size - 1);
+                for (int dest = 1; dest < g_size; dest++) {
+                    MPI_Isend(send_buffer.data(), array_size, MPI_INT, dest, 0, MPI_COMM_WORLD, &requests[dest - 1]);
+                }
+                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+            } else {
+                MPI_Recv(recv_buffer.data(), array_size, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Bcast MPI 1D - Broadcast collectif avec buffer contigu
+// ============================================================================
+static void BM_BcastMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
+    MemoryProbe memory;
+
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            MPI_Bcast(buffer.data(), array_size, MPI_INT, 0, MPI_COMM_WORLD);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+// ============================================================================
+// Benchmark RDMA MPI 1D - One-sided avec buffer contigu
+// ============================================================================
+static void BM_RDMAMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
+
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+    MPI_Win win;
+
+    if (g_rank == 0) {
+        MPI_Win_create(buffer.data(), array_size * sizeof(int), sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
+    } else {
+        MPI_Win_create(nullptr, 0, sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
+    }
+
+    BufferVector<int> recv_buffer(array_size);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            MPI_Win_fence(0, win);
+            if (g_rank != 0) {
+                MPI_Get(recv_buffer.data(), array_size, MPI_INT, 0, 0, array_size, MPI_INT, win);
+            }
+            MPI_Win_fence(0, win);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    MPI_Win_free(&win);
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Boost MPI 1D - Broadcast avec std::vector<int>
+// ============================================================================
+static void BM_BoostMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
+
+    boost::mpi::communicator world;
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            boost::mpi::broadcast(world, buffer, 0);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                world.recv(dest, 1, ack);
+            }
+        } else {
+            int ack = 1;
+            world.send(0, 1, ack);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+// ============================================================================
+// Benchmarks persistants - requêtes créées une seule fois hors de la boucle chronométrée
+// La forme est échangée pendant le setup ; chaque itération ne fait que MPI_Startall/MPI_Waitall.
+// Le temps de setup (max sur les ranks) est reporté dans le compteur "setup_us".
+// ============================================================================
+
+// Helper pour reporter le coût de création des requêtes persistantes
+static void SetSetupCounter(benchmark::State& state, double setup_time) {
+    double max_setup;
+    MPI_Allreduce(&setup_time, &max_setup, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    state.counters["setup_us"] = max_setup * 1e6;
+}
+
+// ============================================================================
+// Benchmark Persistent Raw MPI - MPI_Send_init/MPI_Recv_init
+// ============================================================================
+static void BM_PersistentRawMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    // MPI_Startall démarre les requêtes dans un ordre quelconque : un tag par vecteur est
+    // nécessaire pour les apparier, ce qui borne outer_size par MPI_TAG_UB
+    int* tag_ub;
+    int flag;
+    MPI_Comm_get_attr(MPI_COMM_WORLD, MPI_TAG_UB, &tag_ub, &flag);
+    if (flag && outer_size > *tag_ub - 2) {
+        state.SkipWithError("BM_PersistentRawMPI: outer_size exceeds MPI_TAG_UB");
+        return;
+    }
+
+    VectorOfVectors recv_vec;
+    int recv_outer_size = 0;
+    std::vector<int> recv_inner_sizes;
+    std::vector<MPI_Request> requests;
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double setup_start = MPI_Wtime();
+    if (g_rank == 0) {
+        for (int dest = 1; dest < g_size; dest++) {
+            MPI_Send(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD);
+            MPI_Send(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD);
+        }
+        // Les tailles restent dans l'ensemble persistant pour garder le même nombre de messages que BM_RawMPI
+        for (int dest = 1; dest < g_size; dest++) {
+            MPI_Request req1, req2;
+            MPI_Send_init(&outer_size, 1, MPI_INT, dest, 0, MPI_COMM_WORLD, &req1);
+            requests.push_back(req1);
+            MPI_Send_init(inner_sizes.data(), outer_size, MPI_INT, dest, 1, MPI_COMM_WORLD, &req2);
+            requests.push_back(req2);
+            for (int j = 0; j < outer_size; j++) {
+                MPI_Request req3;
+                MPI_Send_init(vec.data[j].data(), inner_sizes[j], MPI_INT, dest, 2 + j, MPI_COMM_WORLD, &req3);
+                requests.push_back(req3);
+            }
+        }
+    } else {
+        MPI_Recv(&recv_outer_size, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        recv_inner_sizes.resize(recv_outer_size);
+        MPI_Recv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        recv_vec.data.resize(recv_outer_size);
+        MPI_Request req1, req2;
+        MPI_Recv_init(&recv_outer_size, 1, MPI_INT, 0, 0, MPI_COMM_WORLD, &req1);
+        requests.push_back(req1);
+        MPI_Recv_init(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 1, MPI_COMM_WORLD, &req2);
+        requests.push_back(req2);
+        for (int j = 0; j < recv_outer_size; j++) {
+            MPI_Request req;
+            recv_vec.data[j].resize(recv_inner_sizes[j]);
+            MPI_Recv_init(recv_vec.data[j].data(), recv_inner_sizes[j], MPI_INT, 0, 2 + j, MPI_COMM_WORLD, &req);
+            requests.push_back(req);
+        }
+    }
+    double setup_time = MPI_Wtime() - setup_start;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            MPI_Startall(requests.size(), requests.data());
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    for (auto& req : requests) {
+        MPI_Request_free(&req);
+    }
+    SetSetupCounter(state, setup_time);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+#ifdef BENCH_BCAST_INIT
+// ============================================================================
+// Benchmark Persistent Bcast MPI - MPI_Bcast_init (MPI-4 ou MPIX)
+// ============================================================================
+static void BM_PersistentBcastMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    VectorOfVectors recv_vec;
+    std::vector<MPI_Request> requests;
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double setup_start = MPI_Wtime();
+    MPI_Bcast(&outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    inner_sizes.resize(outer_size);
+    MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+    // Même séquence de collectives sur tous les ranks : tailles puis chaque vecteur
+    MPI_Request req1, req2;
+    BENCH_BCAST_INIT(&outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD, MPI_INFO_NULL, &req1);
+    requests.push_back(req1);
+    BENCH_BCAST_INIT(inner_sizes.data(), outer_size, MPI_INT, 0, MPI_COMM_WORLD, MPI_INFO_NULL, &req2);
+    requests.push_back(req2);
+    if (g_rank != 0) {
+        recv_vec.data.resize(outer_size);
+    }
+    for (int j = 0; j < outer_size; j++) {
+        int* buffer = vec.data[j].data();
+        if (g_rank != 0) {
+            recv_vec.data[j].resize(inner_sizes[j]);
+            buffer = recv_vec.data[j].data();
+        }
+        MPI_Request req;
+        BENCH_BCAST_INIT(buffer, inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD, MPI_INFO_NULL, &req);
+        requests.push_back(req);
+    }
+    double setup_time = MPI_Wtime() - setup_start;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            MPI_Startall(requests.size(), requests.data());
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    for (auto& req : requests) {
+        MPI_Request_free(&req);
+    }
+    SetSetupCounter(state, setup_time);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+#endif
+
+// ============================================================================
+// Benchmark Persistent Raw MPI 1D - MPI_Send_init/MPI_Recv_init sur buffer contigu
+// ============================================================================
+static void BM_PersistentRawMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
+
+    BufferVector<int> send_buffer(array_size, 42);
+    BufferVector<int> recv_buffer(array_size);
+    std::vector<MPI_Request> requests;
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double setup_start = MPI_Wtime();
+    if (g_rank == 0) {
+        requests.resize(g_size - 1);
+        for (int dest = 1; dest < g_size; dest++) {
+            MPI_Send_init(send_buffer.data(), array_size, MPI_INT, dest, 0, MPI_COMM_WORLD, &requests[dest - 1]);
+        }
+    } else {
+        requests.resize(1);
+        MPI_Recv_init(recv_buffer.data(), array_size, MPI_INT, 0, 0, MPI_COMM_WORLD, &requests[0]);
+    }
+    double setup_time = MPI_Wtime() - setup_start;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            MPI_Startall(requests.size(), requests.data());
+            MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    for (auto& req : requests) {
+        MPI_Request_free(&req);
+    }
+    SetSetupCounter(state, setup_time);
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+#ifdef BENCH_BCAST_INIT
+// ============================================================================
+// Benchmark Persistent Bcast MPI 1D - MPI_Bcast_init sur buffer contigu
+// ============================================================================
+static void BM_PersistentBcastMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
+
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+    MPI_Request request;
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double setup_start = MPI_Wtime();
+    BENCH_BCAST_INIT(buffer.data(), array_size, MPI_INT, 0, MPI_COMM_WORLD, MPI_INFO_NULL, &request);
+    double setup_time = MPI_Wtime() - setup_start;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            MPI_Start(&request);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    MPI_Request_free(&request);
+    SetSetupCounter(state, setup_time);
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+#endif
+
+// ============================================================================
+// Broadcast pipeliné - le buffer est découpé en segments, avec au plus `depth`
+// MPI_Ibcast en vol, pour que les ranks intermédiaires relaient un segment
+// pendant qu'ils reçoivent le suivant.
+// ============================================================================
+
+// Fenêtre glissante de requêtes : on attend la plus ancienne avant d'en poster une nouvelle
+class BcastPipeline {
+public:
+    BcastPipeline(int segment_elems, int depth, int root, MPI_Comm comm)
+        : segment_elems_(segment_elems), root_(root), comm_(comm), window_(depth, MPI_REQUEST_NULL), next_(0) {}
+
+    // Poste les segments de `buffer` ; peut être appelé sur plusieurs buffers avant finish()
+    void post(int* buffer, int count) {
+        for (int offset = 0; offset < count; offset += segment_elems_) {
+            int seg = std::min(segment_elems_, count - offset);
+            MPI_Request& slot = window_[next_];
+            MPI_Wait(&slot, MPI_STATUS_IGNORE);
+            MPI_Ibcast(buffer + offset, seg, MPI_INT, root_, comm_, &slot);
+            next_ = (next_ + 1) % window_.size();
+        }
+    }
+
+    void finish() {
+        MPI_Waitall(window_.size(), window_.data(), MPI_STATUSES_IGNORE);
+        next_ = 0;
+    }
+
+private:
+    int segment_elems_;
+    int root_;
+    MPI_Comm comm_;
+    std::vector<MPI_Request> window_;
+    size_t next_;
+};
+
+// Args de sweep : taille de segment en KiB -> nombre d'ints
+inline int segment_elements(int segment_kib) {
+    return segment_kib * 1024 / sizeof(int);
+}
+
+// ============================================================================
+// Benchmark Pipelined Bcast MPI - segments de tous les vecteurs dans une même fenêtre
+// Args: {outer_size, base_size, segment_kib, depth}
+// ============================================================================
+static void BM_PipelinedBcastMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int segment_elems = segment_elements(state.range(2));
+    int depth = state.range(3);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    BcastPipeline pipeline(segment_elems, depth, 0, MPI_COMM_WORLD);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                MPI_Bcast(&outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+                MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+                for (int j = 0; j < outer_size; j++) {
+                    pipeline.post(vec.data[j].data(), inner_sizes[j]);
+                }
+                pipeline.finish();
+            } else {
+                VectorOfVectors recv_vec;
+                int recv_outer_size;
+                MPI_Bcast(&recv_outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+                std::vector<int> recv_inner_sizes(recv_outer_size);
+                MPI_Bcast(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+                recv_vec.data.resize(recv_outer_size);
+                for (int j = 0; j < recv_outer_size; j++) {
+                    recv_vec.data[j].resize(recv_inner_sizes[j]);
+                    pipeline.post(recv_vec.data[j].data(), recv_inner_sizes[j]);
+                }
+                pipeline.finish();
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Pipelined Bcast MPI 1D
+// Args: {array_size, segment_kib, depth}
+// ============================================================================
+static void BM_PipelinedBcastMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int segment_elems = segment_elements(state.range(1));
+    int depth = state.range(2);
+    int inner_iters = get_inner_iterations_1d(array_size);
+
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+    BcastPipeline pipeline(segment_elems, depth, 0, MPI_COMM_WORLD);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            pipeline.post(buffer.data(), array_size);
+            pipeline.finish();
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+// ============================================================================
+// RMA passive-target - MPI_Win_allocate + MPI_Win_lock_all pour toute la durée du run
+// Le root expose [done][outer_size][inner_sizes][values] ; chaque receveur expose
+// un drapeau [ready]. Le root notifie par MPI_Accumulate(MPI_REPLACE) sur le drapeau,
+// les receveurs tirent les données par MPI_Rget découpés en chunks puis incrémentent
+// "done" chez le root, qui attend tous les receveurs avant l'opération suivante.
+// ============================================================================
+
+// Lecture atomique d'un entier de la fenêtre (y compris sur le rank local)
+inline int rma_atomic_read(int target, MPI_Aint disp, MPI_Win win) {
+    int value;
+    MPI_Fetch_and_op(nullptr, &value, MPI_INT, target, disp, MPI_NO_OP, win);
+    MPI_Win_flush(target, win);
+    return value;
+}
+
+inline void rma_wait_until(int target, MPI_Aint disp, int expected, MPI_Win win) {
+    while (rma_atomic_read(target, disp, win) < expected) {
+    }
+}
+
+// Poste des MPI_Rget d'au plus chunk_elems ints depuis le root
+inline void rma_rget_chunked(int* dst, int count, MPI_Aint disp, int chunk_elems, MPI_Win win,
+                             std::vector<MPI_Request>& requests) {
+    for (int offset = 0; offset < count; offset += chunk_elems) {
+        int chunk = std::min(chunk_elems, count - offset);
+        MPI_Request req;
+        MPI_Rget(dst + offset, chunk, MPI_INT, 0, disp + offset, chunk, MPI_INT, win, &req);
+        requests.push_back(req);
+    }
+}
+
+// Côté root : notifie chaque receveur puis attend leurs acquittements
+inline void rma_publish(int seq, MPI_Win win) {
+    for (int dest = 1; dest < g_size; dest++) {
+        MPI_Accumulate(&seq, 1, MPI_INT, dest, 0, 1, MPI_INT, MPI_REPLACE, win);
+    }
+    MPI_Win_flush_all(win);
+    rma_wait_until(0, 0, seq * (g_size - 1), win);
+}
+
+// Côté receveur : signale au root que la lecture est terminée
+inline void rma_acknowledge(MPI_Win win) {
+    int one = 1;
+    MPI_Accumulate(&one, 1, MPI_INT, 0, 0, 1, MPI_INT, MPI_SUM, win);
+    MPI_Win_flush(0, win);
+}
+
+// ============================================================================
+// Benchmark Passive RMA MPI
+// Args: {outer_size, base_size, chunk_kib}
+// ============================================================================
+static void BM_PassiveRMAMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int chunk_elems = segment_elements(state.range(2));
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    long total_elements = vec.total_elements();
+
+    // Root : [done][outer_size][inner_sizes...][values...], receveurs : [ready]
+    MPI_Aint header_size = 2 + outer_size;
+    MPI_Aint win_elems = g_rank == 0 ? header_size + total_elements : 1;
+    int* base;
+    MPI_Win win;
+    MPI_Win_allocate(win_elems * sizeof(int), sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &base, &win);
+    base[0] = 0;
+    if (g_rank == 0) {
+        base[1] = outer_size;
+        MPI_Aint offset = header_size;
+        for (int j = 0; j < outer_size; j++) {
+            base[2 + j] = vec.data[j].size();
+            std::copy(vec.data[j].begin(), vec.data[j].end(), base + offset);
+            offset += vec.data[j].size();
+        }
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Win_lock_all(0, win);
+
+    int seq = 0;
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            seq++;
+            if (g_rank == 0) {
+                rma_publish(seq, win);
+            } else {
+                rma_wait_until(g_rank, 0, seq, win);
+
+                VectorOfVectors recv_vec;
+                int recv_outer_size;
+                MPI_Get(&recv_outer_size, 1, MPI_INT, 0, 1, 1, MPI_INT, win);
+                MPI_Win_flush_local(0, win);
+                std::vector<int> recv_inner_sizes(recv_outer_size);
+                MPI_Get(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, 2, recv_outer_size, MPI_INT, win);
+                MPI_Win_flush_local(0, win);
+
+                // Lecture directe dans chaque vecteur interne, sans buffer intermédiaire
+                recv_vec.data.resize(recv_outer_size);
+                std::vector<MPI_Request> requests;
+                MPI_Aint disp = 2 + recv_outer_size;
+                for (int j = 0; j < recv_outer_size; j++) {
+                    recv_vec.data[j].resize(recv_inner_sizes[j]);
+                    rma_rget_chunked(recv_vec.data[j].data(), recv_inner_sizes[j], disp, chunk_elems, win, requests);
+                    disp += recv_inner_sizes[j];
+                }
+                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                rma_acknowledge(win);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Passive RMA MPI 1D
+// Args: {array_size, chunk_kib}
+// ============================================================================
+static void BM_PassiveRMAMPI_1D(benchmark::State& state) {
+    int array_size = state.range(0);
+    int chunk_elems = segment_elements(state.range(1));
+    int inner_iters = get_inner_iterations_1d(array_size);
+
+    // Root : [done][values...], receveurs : [ready]
+    MPI_Aint win_elems = g_rank == 0 ? 1 + (MPI_Aint)array_size : 1;
+    int* base;
+    MPI_Win win;
+    MPI_Win_allocate(win_elems * sizeof(int), sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &base, &win);
+    base[0] = 0;
+    if (g_rank == 0) {
+        std::fill(base + 1, base + 1 + array_size, 42);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Win_lock_all(0, win);
+
+    BufferVector<int> recv_buffer(array_size);
+
+    int seq = 0;
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            seq++;
+            if (g_rank == 0) {
+                rma_publish(seq, win);
+            } else {
+                rma_wait_until(g_rank, 0, seq, win);
+
+                std::vector<MPI_Request> requests;
+                rma_rget_chunked(recv_buffer.data(), array_size, 1, chunk_elems, win, requests);
+                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+                rma_acknowledge(win);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+    SetBytesProcessed1D(state, array_size, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Boost Skeleton MPI - skeleton broadcasté une fois, content à chaque itération
+// Le content réutilise le datatype MPI construit par get_content() : pas de sérialisation
+// dans la boucle. Le coût skeleton + get_content est reporté dans "setup_us".
+// ============================================================================
+static void BM_BoostSkeletonMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    boost::mpi::communicator world;
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    VectorOfVectors recv_vec;
+    VectorOfVectors& target = g_rank == 0 ? vec : recv_vec;
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double setup_start = MPI_Wtime();
+    boost::mpi::broadcast(world, boost::mpi::skeleton(target), 0);
+    boost::mpi::content content = boost::mpi::get_content(target);
+    double setup_time = MPI_Wtime() - setup_start;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            boost::mpi::broadcast(world, content, 0);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                world.recv(dest, 1, ack);
+            }
+        } else {
+            int ack = 1;
+            world.send(0, 1, ack);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetSetupCounter(state, setup_time);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Boost Skeleton Resend MPI - skeleton renvoyé quand la forme change
+// Le root alterne toutes les `shape_period` itérations entre deux structures de même
+// taille totale mais de formes différentes (tailles internes en ordre inverse).
+// Un drapeau est broadcasté à chaque itération ; si la forme a changé, skeleton et
+// content sont regénérés avant le broadcast du content.
+// Args: {outer_size, base_size, shape_period}
+// ============================================================================
+static void BM_BoostSkeletonResendMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int shape_period = state.range(2);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    boost::mpi::communicator world;
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    VectorOfVectors vec_alt;
+    vec_alt.data.assign(vec.data.rbegin(), vec.data.rend());
+    VectorOfVectors recv_vec;
+
+    std::vector<int> last_sizes;
+    boost::mpi::content content;
+    long shape_changes = 0;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            int changed = 0;
+            VectorOfVectors* target = &recv_vec;
+            if (g_rank == 0) {
+                target = (iter / shape_period) % 2 == 0 ? &vec : &vec_alt;
+                int outer_size = target->data.size();
+                changed = (int)last_sizes.size() != outer_size;
+                for (int j = 0; j < outer_size && !changed; j++) {
+                    changed = last_sizes[j] != (int)target->data[j].size();
+                }
+                if (changed) {
+                    last_sizes.resize(outer_size);
+                    for (int j = 0; j < outer_size; j++) {
+                        last_sizes[j] = target->data[j].size();
+                    }
+                }
+            }
+            boost::mpi::broadcast(world, changed, 0);
+            if (changed) {
+                boost::mpi::broadcast(world, boost::mpi::skeleton(*target), 0);
+                content = boost::mpi::get_content(*target);
+                shape_changes++;
+            }
+            boost::mpi::broadcast(world, content, 0);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                world.recv(dest, 1, ack);
+            }
+        } else {
+            int ack = 1;
+            world.send(0, 1, ack);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    state.counters["shape_changes"] = shape_changes;
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Threaded MPI - MPI_THREAD_MULTIPLE, un communicateur dupliqué par thread
+// Les tailles sont broadcastées par le thread principal ; chaque vecteur interne
+// (découpé en `threads` chunks au-delà de THREADED_CHUNK_MIN ints) devient un
+// élément de travail attribué en round-robin à un thread du pool, qui l'envoie
+// (root) ou le reçoit (autres ranks) sur son propre communicateur.
+// Nécessite --mpi_thread_multiple ; sinon le benchmark est ignoré.
+// Args: {outer_size, base_size, threads}
+// ============================================================================
+#define THREADED_CHUNK_MIN 65536
+
+// Pool de threads persistant : run(fn) exécute fn(tid) sur tous les threads
+// (le thread appelant est le tid 0) et attend la fin de tous
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads) : generation_(0), pending_(0), stop_(false) {
+        for (int tid = 1; tid < threads; tid++) {
+            workers_.emplace_back([this, tid] { worker_loop(tid); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void run(const std::function<void(int)>& fn) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = fn;
+            pending_ = workers_.size();
+            generation_++;
+        }
+        start_cv_.notify_all();
+        fn(0);
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+private:
+    void worker_loop(int tid) {
+        long seen = 0;
+        while (true) {
+            std::function<void(int)> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+                task = task_;
+            }
+            task(tid);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pending_--;
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::function<void(int)> task_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    long generation_;
+    size_t pending_;
+    bool stop_;
+};
+
+// Élément de travail : un chunk contigu d'un vecteur interne
+struct ThreadedChunk {
+    int vector_index;
+    int offset;
+    int count;
+};
+
+static std::vector<ThreadedChunk> make_threaded_chunks(const std::vector<int>& inner_sizes, int threads) {
+    std::vector<ThreadedChunk> chunks;
+    for (int j = 0; j < (int)inner_sizes.size(); j++) {
+        int parts = inner_sizes[j] > THREADED_CHUNK_MIN ? threads : 1;
+        int base = inner_sizes[j] / parts;
+        int offset = 0;
+        for (int p = 0; p < parts; p++) {
+            int count = p == parts - 1 ? inner_sizes[j] - offset : base;
+            chunks.push_back({j, offset, count});
+            offset += count;
+        }
+    }
+    return chunks;
+}
+
+static void BM_ThreadedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int threads = state.range(2);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    if (g_thread_level < MPI_THREAD_MULTIPLE) {
+        state.SkipWithError("BM_ThreadedMPI requires --mpi_thread_multiple");
+        return;
+    }
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    std::vector<MPI_Comm> comms(threads);
+    for (int t = 0; t < threads; t++) {
+        MPI_Comm_dup(MPI_COMM_WORLD, &comms[t]);
+    }
+    ThreadPool pool(threads);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                MPI_Bcast(&outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+                MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+                std::vector<ThreadedChunk> chunks = make_threaded_chunks(inner_sizes, threads);
+                pool.run([&](int tid) {
+                    RequestWindow window;
+                    for (int c = tid; c < (int)chunks.size(); c += threads) {
+                        const ThreadedChunk& chunk = chunks[c];
+                        for (int dest = 1; dest < g_size; dest++) {
+                            MPI_Isend(vec.data[chunk.vector_index].data() + chunk.offset, chunk.count, MPI_INT,
+                                      dest, TAG_DATA, comms[tid], window.next());
+                        }
+                    }
+                    window.wait_all();
+                });
+            } else {
+                VectorOfVectors recv_vec;
+                int recv_outer_size;
+                MPI_Bcast(&recv_outer_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+                std::vector<int> recv_inner_sizes(recv_outer_size);
+                MPI_Bcast(recv_inner_sizes.data(), recv_outer_size, MPI_INT, 0, MPI_COMM_WORLD);
+
+                recv_vec.data.resize(recv_outer_size);
+                for (int j = 0; j < recv_outer_size; j++) {
+                    recv_vec.data[j].resize(recv_inner_sizes[j]);
+                }
+
+                std::vector<ThreadedChunk> chunks = make_threaded_chunks(recv_inner_sizes, threads);
+                pool.run([&](int tid) {
+                    RequestWindow window;
+                    for (int c = tid; c < (int)chunks.size(); c += threads) {
+                        const ThreadedChunk& chunk = chunks[c];
+                        MPI_Irecv(recv_vec.data[chunk.vector_index].data() + chunk.offset, chunk.count, MPI_INT,
+                                  0, TAG_DATA, comms[tid], window.next());
+                    }
+                    window.wait_all();
+                });
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+
+    for (auto& comm : comms) {
+        MPI_Comm_free(&comm);
+    }
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// Stratégies nested_* (nested_broadcast.hpp) instanciées pour le conteneur du benchmark
+using NestedStrategyFn = BasicNestedStrategyFn<BufferVector<int>>;
+
+// ============================================================================
+// Histogramme de latence log-linéaire (style HDR)
+// 2^LATENCY_SUB_BITS sous-buckets linéaires par puissance de 2 de nanosecondes,
+// soit une erreur relative < 2^-LATENCY_SUB_BITS sur chaque valeur.
+// ============================================================================
+#define LATENCY_SUB_BITS 5
+#define LATENCY_MAGNITUDES 42
+
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKETS = 1 << LATENCY_SUB_BITS;
+    // Magnitudes SUB_BITS..MAGNITUDES incluses, plus la plage linéaire [0, SUB_BUCKETS)
+    static constexpr int BUCKETS = (LATENCY_MAGNITUDES - LATENCY_SUB_BITS + 2) * SUB_BUCKETS;
+
+    LatencyHistogram() : counts_(BUCKETS, 0), max_ns_(0) {}
+
+    void record(double seconds) {
+        uint64_t ns = seconds > 0 ? (uint64_t)(seconds * 1e9) : 0;
+        counts_[bucket_index(ns)]++;
+        max_ns_ = std::max(max_ns_, ns);
+    }
+
+    uint64_t count() const {
+        uint64_t total = 0;
+        for (uint64_t c : counts_) total += c;
+        return total;
+    }
+
+    // Valeur (ns) du bucket contenant le quantile q
+    double percentile_ns(double q) const {
+        uint64_t total = count();
+        if (total == 0) return 0.0;
+        uint64_t target = std::max<uint64_t>(1, (uint64_t)std::ceil(q * total));
+        uint64_t cumulative = 0;
+        for (int i = 0; i < BUCKETS; i++) {
+            cumulative += counts_[i];
+            if (cumulative >= target) return std::min(bucket_value_ns(i), (double)max_ns_);
+        }
+        return max_ns_;
+    }
+
+    double max_ns() const { return max_ns_; }
+
+    // Fusionne les histogrammes de tous les ranks sur `root`
+    LatencyHistogram merged(int root, MPI_Comm comm) const {
+        LatencyHistogram result;
+        MPI_Reduce(counts_.data(), result.counts_.data(), BUCKETS, MPI_UINT64_T, MPI_SUM, root, comm);
+        MPI_Reduce(&max_ns_, &result.max_ns_, 1, MPI_UINT64_T, MPI_MAX, root, comm);
+        return result;
+    }
+
+private:
+    static int bucket_index(uint64_t ns) {
+        if (ns < (uint64_t)SUB_BUCKETS) return ns;
+        int magnitude = 63 - __builtin_clzll(ns);
+        int shift = std::min(magnitude, LATENCY_MAGNITUDES) - LATENCY_SUB_BITS;
+        int sub = std::min<uint64_t>((ns >> shift) - SUB_BUCKETS, SUB_BUCKETS - 1);
+        return (shift + 1) * SUB_BUCKETS + sub;
+    }
+
+    static double bucket_value_ns(int index) {
+        if (index < SUB_BUCKETS) return index;
+        int shift = index / SUB_BUCKETS - 1;
+        int sub = index % SUB_BUCKETS;
+        // Milieu du bucket
+        return (double)((uint64_t)(SUB_BUCKETS + sub) << shift) + (double)((uint64_t)1 << shift) / 2;
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t max_ns_;
+};
+
+// Écart moyen entre deux MPI_Wtime consécutifs, c'est-à-dire le biais qu'ajoute
+// la paire op_start/op_end à chaque mesure ; à soustraire des petites latences
+static double timer_overhead() {
+    static double overhead = -1.0;
+    if (overhead < 0) {
+        const int samples = 10000;
+        double total = 0.0;
+        for (int i = 0; i < samples; i++) {
+            double t0 = MPI_Wtime();
+            double t1 = MPI_Wtime();
+            total += t1 - t0;
+        }
+        overhead = total / samples;
+    }
+    return overhead;
+}
+
+// Percentiles fusionnés sur tous les ranks + p99 de chaque rank et rank le plus lent
+static void SetLatencyCounters(benchmark::State& state, const LatencyHistogram& hist) {
+    LatencyHistogram merged = hist.merged(0, MPI_COMM_WORLD);
+
+    double rank_p99 = hist.percentile_ns(0.99);
+    std::vector<double> all_p99(g_rank == 0 ? g_size : 0);
+    MPI_Gather(&rank_p99, 1, MPI_DOUBLE, all_p99.data(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+    if (g_rank != 0) return;
+    state.counters["p50_us"] = merged.percentile_ns(0.50) / 1e3;
+    state.counters["p90_us"] = merged.percentile_ns(0.90) / 1e3;
+    state.counters["p99_us"] = merged.percentile_ns(0.99) / 1e3;
+    state.counters["p99.9_us"] = merged.percentile_ns(0.999) / 1e3;
+    state.counters["max_us"] = merged.max_ns() / 1e3;
+    state.counters["timer_overhead_us"] = timer_overhead() * 1e6;
+
+    int slowest = 0;
+    for (int r = 0; r < g_size; r++) {
+        state.counters["rank" + std::to_string(r) + "_p99_us"] = all_p99[r] / 1e3;
+        if (r > 0 && (slowest == 0 || all_p99[r] > all_p99[slowest])) slowest = r;
+    }
+    state.counters["slowest_rank"] = slowest;
+}
+
+// ============================================================================
+// Benchmark Latency MPI - chaque opération est chronométrée individuellement
+// sur chaque rank et enregistrée dans un LatencyHistogram.
+// Args: {outer_size, base_size, strategy (NestedStrategy)}
+// ============================================================================
+static void BM_LatencyMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    NestedStrategyFn strategy = nested_strategy_fn<BufferVector<int>>(state.range(2));
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    LatencyHistogram hist;
+    state.SetLabel(nested_strategy_names[state.range(2)]);
+    timer_overhead();
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            double op_start = MPI_Wtime();
+            if (g_rank == 0) {
+                strategy(MPI_COMM_WORLD, vec.data, 0);
+            } else {
+                VectorOfVectors recv_vec;
+                strategy(MPI_COMM_WORLD, recv_vec.data, 0);
+            }
+            hist.record(MPI_Wtime() - op_start);
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetLatencyCounters(state, hist);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Suite de recouvrement communication/calcul
+// La phase de données de BM_BcastMPI (un MPI_Ibcast par vecteur interne, tailles
+// échangées au setup) est postée, un noyau de calcul synthétique tourne, puis on
+// attend la fin des requêtes. Durée du calcul = compute_pct % du temps de
+// communication seule mesuré au setup.
+// Efficacité de recouvrement = (comm + compute - mesuré) / min(comm, compute)
+// Args: {outer_size, base_size, kernel, progress, compute_pct}
+// ============================================================================
+enum OverlapKernel {
+    KERNEL_STREAM = 0,  // triade a = b + s*c sur des tableaux hors cache (memory-bound)
+    KERNEL_FMA = 1      // chaînes de FMA indépendantes en registres (compute-bound)
+};
+
+enum OverlapProgress {
+    PROGRESS_NONE = 0,    // aucun appel MPI pendant le calcul
+    PROGRESS_TEST = 1,    // MPI_Testall entre chaque unité de calcul
+    PROGRESS_THREAD = 2   // thread dédié qui appelle MPI_Testall (nécessite MPI_THREAD_SERIALIZED)
+};
+
+#define OVERLAP_STREAM_ELEMS (4 * 1024 * 1024)
+#define OVERLAP_STREAM_UNIT  (64 * 1024)
+#define OVERLAP_FMA_UNIT     (16 * 1024)
+
+class ComputeKernel {
+public:
+    explicit ComputeKernel(int kind) : kind_(kind), offset_(0) {
+        if (kind_ == KERNEL_STREAM) {
+            a_.assign(OVERLAP_STREAM_ELEMS, 0.0);
+            b_.assign(OVERLAP_STREAM_ELEMS, 1.0);
+            c_.assign(OVERLAP_STREAM_ELEMS, 2.0);
+        }
+    }
+
+    // Exécute une unité de travail (~quelques dizaines de µs)
+    void run_unit() {
+        if (kind_ == KERNEL_STREAM) {
+            double* a = a_.data() + offset_;
+            const double* b = b_.data() + offset_;
+            const double* c = c_.data() + offset_;
+            for (int i = 0; i < OVERLAP_STREAM_UNIT; i++) {
+                a[i] = b[i] + 3.0 * c[i];
+            }
+            benchmark::DoNotOptimize(a);
+            offset_ = (offset_ + OVERLAP_STREAM_UNIT) % OVERLAP_STREAM_ELEMS;
+        } else {
+            double x[8] = {1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7};
+            for (int i = 0; i < OVERLAP_FMA_UNIT; i++) {
+                for (int k = 0; k < 8; k++) {
+                    x[k] = std::fma(x[k], 0.999999, 1e-7);
+                }
+            }
+            benchmark::DoNotOptimize(x);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    // Nombre d'unités nécessaires pour environ `seconds` de calcul
+    int units_for(double seconds) {
+        const int samples = 64;
+        double start = MPI_Wtime();
+        for (int i = 0; i < samples; i++) {
+            run_unit();
+        }
+        double per_unit = (MPI_Wtime() - start) / samples;
+        return std::max(1, (int)(seconds / per_unit));
+    }
+
+private:
+    int kind_;
+    size_t offset_;
+    std::vector<double> a_, b_, c_;
+};
+
+// Thread de progression persistant : créé une fois avant la boucle chronométrée,
+// réveillé à chaque opération. Le thread principal n'appelle pas MPI entre start()
+// et stop(), d'où MPI_THREAD_SERIALIZED suffisant.
+class ProgressThread {
+public:
+    explicit ProgressThread(std::vector<MPI_Request>& requests)
+        : requests_(requests), thread_([this] { run(); }) {}
+
+    ProgressThread(const ProgressThread&) = delete;
+    ProgressThread& operator=(const ProgressThread&) = delete;
+
+    ~ProgressThread() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            quit_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    // Lance MPI_Testall en boucle sur les requêtes postées
+    void start() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_.store(false, std::memory_order_relaxed);
+            active_ = true;
+        }
+        wake_.notify_one();
+    }
+
+    // Arrête la boucle et attend que le thread ne touche plus à MPI
+    void stop() {
+        stop_.store(true, std::memory_order_release);
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this] { return !active_; });
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [this] { return active_ || quit_; });
+            if (quit_) return;
+            lock.unlock();
+            int done = 0;
+            while (!done && !stop_.load(std::memory_order_acquire)) {
+                MPI_Testall(requests_.size(), requests_.data(), &done, MPI_STATUSES_IGNORE);
+            }
+            lock.lock();
+            active_ = false;
+            idle_.notify_one();
+        }
+    }
+
+    std::vector<MPI_Request>& requests_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::atomic<bool> stop_{false};
+    bool active_ = false;
+    bool quit_ = false;
+    std::thread thread_;  // dernier membre : démarré une fois les autres initialisés
+};
+
+static void BM_OverlapMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int kernel_kind = state.range(2);
+    int progress = state.range(3);
+    double compute_ratio = state.range(4) / 100.0;
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    if (progress == PROGRESS_THREAD && g_thread_level < MPI_THREAD_SERIALIZED) {
+        state.SkipWithError("PROGRESS_THREAD requires MPI_THREAD_SERIALIZED (run with --mpi_thread_multiple)");
+        return;
+    }
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+        if (g_rank != 0) {
+            vec.data[j].assign(inner_sizes[j], 0);
+        }
+    }
+
+    std::vector<MPI_Request> requests(outer_size);
+    auto post = [&] {
+        for (int j = 0; j < outer_size; j++) {
+            MPI_Ibcast(vec.data[j].data(), inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD, &requests[j]);
+        }
+    };
+    auto wait = [&] { MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE); };
+
+    // Références : communication seule, puis calcul seul calibré sur compute_pct % de la communication
+    MPI_Barrier(MPI_COMM_WORLD);
+    double t = MPI_Wtime();
+    for (int iter = 0; iter < inner_iters; iter++) {
+        post();
+        wait();
+    }
+    double comm_time = (MPI_Wtime() - t) / inner_iters;
+    MPI_Allreduce(MPI_IN_PLACE, &comm_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    ComputeKernel kernel(kernel_kind);
+    int units = kernel.units_for(comm_time * compute_ratio);
+    t = MPI_Wtime();
+    for (int iter = 0; iter < inner_iters; iter++) {
+        for (int u = 0; u < units; u++) {
+            kernel.run_unit();
+        }
+    }
+    double compute_time = (MPI_Wtime() - t) / inner_iters;
+    MPI_Allreduce(MPI_IN_PLACE, &compute_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    std::unique_ptr<ProgressThread> progress_thread;
+    if (progress == PROGRESS_THREAD) {
+        progress_thread.reset(new ProgressThread(requests));
+    }
+
+    double measured_total = 0.0;
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            post();
+            if (progress_thread) {
+                progress_thread->start();
+                for (int u = 0; u < units; u++) {
+                    kernel.run_unit();
+                }
+                progress_thread->stop();
+            } else {
+                int done = 0;
+                for (int u = 0; u < units; u++) {
+                    kernel.run_unit();
+                    if (progress == PROGRESS_TEST && !done) {
+                        MPI_Testall(requests.size(), requests.data(), &done, MPI_STATUSES_IGNORE);
+                    }
+                }
+            }
+            wait();
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+        measured_total += max_per_op;
+    }
+
+    double measured = measured_total / state.iterations();
+    state.counters["comm_us"] = comm_time * 1e6;
+    state.counters["compute_us"] = compute_time * 1e6;
+    state.counters["overlap_eff"] = (comm_time + compute_time - measured) / std::min(comm_time, compute_time);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Scaling MPI - balayage du nombre de processus dans un seul lancement
+// Les `comm_size` premiers ranks forment un sous-communicateur sur lequel tourne
+// la stratégie ; les autres ranks ne participent qu'à la synchronisation finale.
+// Enregistré dynamiquement depuis main() pour comm_size = 2, 4, 8, ... <= g_size.
+// Args: {outer_size, base_size, strategy (NestedStrategy), comm_size, root_placement}
+// ============================================================================
+enum RootPlacement {
+    ROOT_FIRST = 0,  // root = premier rank du sous-communicateur
+    ROOT_LAST = 1    // root = dernier rank du sous-communicateur
+};
+
+static void BM_ScalingMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    NestedStrategyFn strategy = nested_strategy_fn<BufferVector<int>>(state.range(2));
+    int comm_size = state.range(3);
+    int root = state.range(4) == ROOT_LAST ? comm_size - 1 : 0;
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    state.SetLabel(nested_strategy_names[state.range(2)]);
+
+    MPI_Comm sub_comm;
+    MPI_Comm_split(MPI_COMM_WORLD, g_rank < comm_size ? 0 : MPI_UNDEFINED, g_rank, &sub_comm);
+    int sub_rank = -1;
+    if (sub_comm != MPI_COMM_NULL) {
+        MPI_Comm_rank(sub_comm, &sub_rank);
+    }
+
+    double time_total = 0.0;
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        if (sub_comm != MPI_COMM_NULL) {
+            for (int iter = 0; iter < inner_iters; iter++) {
+                if (sub_rank == root) {
+                    strategy(sub_comm, vec.data, root);
+                } else {
+                    VectorOfVectors recv_vec;
+                    strategy(sub_comm, recv_vec.data, root);
+                }
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+        time_total += max_per_op;
+    }
+
+    if (sub_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&sub_comm);
+    }
+
+    // Bande passante par receveur et agrégée, à partir du temps moyen par opération
+    double per_op = time_total / state.iterations();
+    double payload = (double)vec.total_elements() * sizeof(int);
+    state.counters["ranks"] = comm_size;
+    state.counters["recv_bw"] = benchmark::Counter(payload / per_op, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.counters["aggregate_bw"] = benchmark::Counter(payload * (comm_size - 1) / per_op, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// Sous-communicateurs de 2, 4, 8, ... ranks, plus la taille totale si ce n'est pas une puissance de 2
+static void RegisterScalingBenchmarks() {
+    std::vector<int> comm_sizes;
+    for (int n = 2; n <= g_size; n *= 2) {
+        comm_sizes.push_back(n);
+    }
+    if (g_size >= 2 && comm_sizes.back() != g_size) {
+        comm_sizes.push_back(g_size);
+    }
+
+    for (int base_size : {500, 50000, 500000}) {
+        for (int strategy = 0; strategy < NESTED_STRATEGY_COUNT; strategy++) {
+            for (int comm_size : comm_sizes) {
+                for (int placement : {ROOT_FIRST, ROOT_LAST}) {
+                    benchmark::RegisterBenchmark("BM_ScalingMPI", BM_ScalingMPI)
+                        ->Args({5, base_size, strategy, comm_size, placement})
+                        ->ArgNames({"outer", "base", "strategy", "ranks", "root"})
+                        ->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Benchmark Nested MPI - n'importe quelle stratégie nested_* choisie en argument
+// Args: {outer_size, base_size, strategy (NestedStrategy)}
+// ============================================================================
+static void BM_NestedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    NestedStrategyFn strategy = nested_strategy_fn<BufferVector<int>>(state.range(2));
+    int inner_iters = get_inner_iterations(base_size_param);
+    MemoryProbe memory;
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    state.SetLabel(nested_strategy_names[state.range(2)]);
+
+    memory.begin_loop();
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                strategy(MPI_COMM_WORLD, vec.data, 0);
+            } else {
+                VectorOfVectors recv_vec;
+                strategy(MPI_COMM_WORLD, recv_vec.data, 0);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    memory.report(state, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// Table de réglage de broadcast_nested() utilisée par ce processus (voir main)
+static NestedTuning g_nested_tuning = default_nested_tuning();
+static bool g_nested_tuning_measured = false;
+
+// ============================================================================
+// Benchmark Tuned Nested MPI - broadcast_nested() avec la table de réglage
+// Sans fichier de réglage ni --nested_calibrate, la calibration est faite au
+// premier appel (setup_us). Le label indique la stratégie choisie, marquée
+// "(extrapolated)" au-delà de la plus grande taille calibrée ; les stratégies
+// fixes sont mesurées par BM_NestedMPI dans le même harnais.
+// ============================================================================
+static void BM_TunedNestedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    double setup_time = 0.0;
+    if (!g_nested_tuning_measured) {
+        double setup_start = MPI_Wtime();
+        g_nested_tuning = calibrate_nested_tuning<BufferVector<int>>(MPI_COMM_WORLD);
+        g_nested_tuning_measured = true;
+        setup_time = MPI_Wtime() - setup_start;
+    }
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    long payload_bytes = vec.total_elements() * static_cast<long>(sizeof(int));
+    int chosen = g_nested_tuning.pick(payload_bytes);
+    bool extrapolated = g_nested_tuning.extrapolated(payload_bytes);
+    state.SetLabel(std::string("tuned:") + nested_strategy_names[chosen] + (extrapolated ? " (extrapolated)" : ""));
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                broadcast_nested(MPI_COMM_WORLD, vec.data, 0, g_nested_tuning);
+            } else {
+                VectorOfVectors recv_vec;
+                broadcast_nested(MPI_COMM_WORLD, recv_vec.data, 0, g_nested_tuning);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetSetupCounter(state, setup_time);
+    state.counters["extrapolated"] = extrapolated;
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmarks Typed - stratégies nested_* et Boost.MPI pour un type d'élément T
+// Même nombre d'éléments que les configurations int : la taille en octets
+// croît avec sizeof(T). Le label indique le chemin du datatype MPI.
+// ============================================================================
+template <typename T>
+static const char* mpi_type_kind() {
+    if (std::is_arithmetic<T>::value) return "builtin";
+    return mpi_type_traits<T>::is_struct ? "struct" : "bytes";
+}
+
+// Args: {outer_size, base_size, strategy (NestedStrategy)}
+template <typename T>
+static void BM_TypedNestedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    BasicNestedStrategyFn<BufferVector<T>> strategy = nested_strategy_fn<BufferVector<T>>(state.range(2));
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    BasicVectorOfVectors<T> vec(outer_size_param, base_size_param);
+    state.SetLabel(std::string(nested_strategy_names[state.range(2)]) + "/" + mpi_type_kind<T>());
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                strategy(MPI_COMM_WORLD, vec.data, 0);
+            } else {
+                BasicVectorOfVectors<T> recv_vec;
+                strategy(MPI_COMM_WORLD, recv_vec.data, 0);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// Sérialisation Boost : les types de base profitent de l'optimisation tableau,
+// les structs sont sérialisées champ par champ
+template <typename T>
+static void BM_TypedBoostMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    boost::mpi::communicator world;
+    BasicVectorOfVectors<T> vec(outer_size_param, base_size_param);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                for (int dest = 1; dest < g_size; dest++) {
+                    world.send(dest, 0, vec);
+                }
+            } else {
+                BasicVectorOfVectors<T> recv_vec;
+                world.recv(0, 0, recv_vec);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                world.recv(dest, 1, ack);
+            }
+        } else {
+            int ack = 1;
+            world.send(0, 1, ack);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Générateurs de contenu - remplacent le remplissage à 0 (ou 42 en 1D), qui
+// avantagerait injustement tout transport compressant
+// Le contenu est généré en continu sur la concaténation des vecteurs internes.
+// ============================================================================
+enum ContentKind {
+    CONTENT_ZERO = 0,      // comportement historique
+    CONTENT_RANDOM = 1,    // entiers 32 bits uniformes (incompressible)
+    CONTENT_SMOOTH = 2,    // champ lisse : sinusoïde + bruit de faible amplitude
+    CONTENT_SPARSE = 3,    // ~95 % de zéros
+    CONTENT_MONOTONIC = 4  // identifiants croissants, pas de 1 à 4
+};
+
+static const char* const content_names[] = {"zero", "random", "smooth", "sparse", "monotonic"};
+
+static void fill_content(VectorOfVectors& vec, ContentKind kind, unsigned seed = 12345) {
+    std::mt19937 rng(seed);
+    long index = 0;
+    int id = 0;
+    for (auto& inner : vec.data) {
+        for (int& value : inner) {
+            switch (kind) {
+                case CONTENT_ZERO: value = 0; break;
+                case CONTENT_RANDOM: value = static_cast<int>(rng()); break;
+                case CONTENT_SMOOTH: value = static_cast<int>(100000.0 * std::sin(index * 0.001)) + rng() % 8; break;
+                case CONTENT_SPARSE: value = rng() % 100 < 95 ? 0 : static_cast<int>(rng()); break;
+                case CONTENT_MONOTONIC: id += 1 + rng() % 4; value = id; break;
+            }
+            index++;
+        }
+    }
+}
+
+// ============================================================================
+// Codec delta + bit-packing pour entiers
+// Blocs de BITPACK_BLOCK valeurs : deltas zigzag (petits entiers non signés),
+// puis chaque valeur sur `bits` bits, `bits` = largeur du plus grand delta du bloc.
+// Format d'un bloc : 1 octet `bits`, puis les valeurs packées.
+// - bloc complet : disposition verticale sur BITPACK_LANES voies de 32 bits (la
+//   valeur k va dans la voie k % 4, le mot w de la voie l à l'indice 4 * w + l),
+//   soit 16 * bits octets ; delta, zigzag, réduction OR, packing et préfixe de
+//   décodage sont faits 4 valeurs à la fois en SSE2 (socle de x86-64), avec un
+//   noyau déroulé par largeur instancié par template (décalages constants)
+// - dernier bloc incomplet d'un vecteur : mots de 32 bits little-endian dans
+//   l'ordre des valeurs, le dernier tronqué à l'octet
+// Sans SSE2, des boucles scalaires produisent le même format.
+// ============================================================================
+#define BITPACK_BLOCK 128
+#define BITPACK_LANES 4
+
+static size_t delta_bitpack_bound(size_t n) {
+    return n * sizeof(int) + (n + BITPACK_BLOCK - 1) / BITPACK_BLOCK;
+}
+
+#ifdef __SSE2__
+// Deltas zigzag d'un bloc complet (`prev` = dernière valeur du bloc précédent) ; retourne l'OR des deltas
+static uint32_t delta_zigzag_block(const int* in, uint32_t prev, uint32_t* zz) {
+    __m128i last = _mm_set_epi32(static_cast<int>(prev), 0, 0, 0);
+    __m128i bits_or = _mm_setzero_si128();
+    for (int i = 0; i < BITPACK_BLOCK / BITPACK_LANES; i++) {
+        __m128i cur = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in) + i);
+        __m128i shifted = _mm_or_si128(_mm_slli_si128(cur, 4), _mm_srli_si128(last, 12));
+        __m128i delta = _mm_sub_epi32(cur, shifted);
+        __m128i z = _mm_xor_si128(_mm_slli_epi32(delta, 1), _mm_srai_epi32(delta, 31));
+        _mm_store_si128(reinterpret_cast<__m128i*>(zz) + i, z);
+        bits_or = _mm_or_si128(bits_or, z);
+        last = cur;
+    }
+    bits_or = _mm_or_si128(bits_or, _mm_shuffle_epi32(bits_or, _MM_SHUFFLE(1, 0, 3, 2)));
+    bits_or = _mm_or_si128(bits_or, _mm_shuffle_epi32(bits_or, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(bits_or));
+}
+
+// Inverse : dézigzag puis somme préfixe, 4 valeurs par vecteur
+static void unzigzag_prefix_block(const uint32_t* zz, uint32_t prev, int* out) {
+    __m128i last = _mm_set1_epi32(static_cast<int>(prev));
+    const __m128i one = _mm_set1_epi32(1);
+    for (int i = 0; i < BITPACK_BLOCK / BITPACK_LANES; i++) {
+        __m128i z = _mm_load_si128(reinterpret_cast<const __m128i*>(zz) + i);
+        __m128i delta = _mm_xor_si128(_mm_srli_epi32(z, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(z, one)));
+        delta = _mm_add_epi32(delta, _mm_slli_si128(delta, 4));
+        delta = _mm_add_epi32(delta, _mm_slli_si128(delta, 8));
+        __m128i values = _mm_add_epi32(delta, last);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out) + i, values);
+        last = _mm_shuffle_epi32(values, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+}
+
+// Noyaux par largeur B : les 32 vecteurs du bloc produisent exactement B vecteurs
+template <int B>
+static void bitpack_block_width(const uint32_t* zz, uint8_t* out) {
+    const __m128i* in = reinterpret_cast<const __m128i*>(zz);
+    __m128i* op = reinterpret_cast<__m128i*>(out);
+    __m128i acc = _mm_setzero_si128();
+    int filled = 0;
+#pragma GCC unroll 32
+    for (int i = 0; i < BITPACK_BLOCK / BITPACK_LANES; i++) {
+        __m128i v = _mm_load_si128(in + i);
+        acc = _mm_or_si128(acc, _mm_slli_epi32(v, filled));
+        filled += B;
+        if (filled >= 32) {
+            _mm_storeu_si128(op++, acc);
+            filled -= 32;
+            acc = filled ? _mm_srli_epi32(v, B - filled) : _mm_setzero_si128();
+        }
+    }
+}
+
+template <int B>
+static void bitunpack_block_width(const uint8_t* in, uint32_t* zz) {
+    const __m128i* ip = reinterpret_cast<const __m128i*>(in);
+    __m128i* out = reinterpret_cast<__m128i*>(zz);
+    const __m128i mask = _mm_set1_epi32(static_cast<int>(B == 32 ? 0xffffffffu : (1u << (B % 32)) - 1));
+    __m128i word = _mm_loadu_si128(ip++);
+    int shift = 0;
+#pragma GCC unroll 32
+    for (int i = 0; i < BITPACK_BLOCK / BITPACK_LANES; i++) {
+        __m128i v = _mm_srli_epi32(word, shift);
+        shift += B;
+        if (shift >= 32) {
+            shift -= 32;
+            if (i + 1 < BITPACK_BLOCK / BITPACK_LANES) word = _mm_loadu_si128(ip++);
+            if (shift > 0) v = _mm_or_si128(v, _mm_slli_epi32(word, B - shift));
+        }
+        _mm_store_si128(out + i, _mm_and_si128(v, mask));
+    }
+}
+
+typedef void (*BitpackKernel)(const uint32_t*, uint8_t*);
+typedef void (*BitunpackKernel)(const uint8_t*, uint32_t*);
+
+// Tables indexées par `bits` (1..32)
+template <int... B>
+static constexpr std::array<BitpackKernel, 33> make_bitpack_kernels(std::integer_sequence<int, B...>) {
+    return {{nullptr, &bitpack_block_width<B + 1>...}};
+}
+template <int... B>
+static constexpr std::array<BitunpackKernel, 33> make_bitunpack_kernels(std::integer_sequence<int, B...>) {
+    return {{nullptr, &bitunpack_block_width<B + 1>...}};
+}
+static constexpr auto bitpack_kernels = make_bitpack_kernels(std::make_integer_sequence<int, 32>{});
+static constexpr auto bitunpack_kernels = make_bitunpack_kernels(std::make_integer_sequence<int, 32>{});
+
+static void bitpack_block(const uint32_t* zz, int bits, uint8_t* out) {
+    bitpack_kernels[bits](zz, out);
+}
+
+static void bitunpack_block(const uint8_t* in, int bits, uint32_t* zz) {
+    bitunpack_kernels[bits](in, zz);
+}
+#else
+static uint32_t delta_zigzag_block(const int* in, uint32_t prev, uint32_t* zz) {
+    const uint32_t* block = reinterpret_cast<const uint32_t*>(in);
+    uint32_t bits_or = 0;
+    for (int k = 0; k < BITPACK_BLOCK; k++) {
+        uint32_t delta = block[k] - (k ? block[k - 1] : prev);
+        zz[k] = (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+        bits_or |= zz[k];
+    }
+    return bits_or;
+}
+
+static void unzigzag_prefix_block(const uint32_t* zz, uint32_t prev, int* out) {
+    uint32_t* dst = reinterpret_cast<uint32_t*>(out);
+    for (int k = 0; k < BITPACK_BLOCK; k++) {
+        prev += (zz[k] >> 1) ^ (0u - (zz[k] & 1));
+        dst[k] = prev;
+    }
+}
+
+static void bitpack_block(const uint32_t* zz, int bits, uint8_t* out) {
+    for (int lane = 0; lane < BITPACK_LANES; lane++) {
+        uint64_t acc = 0;
+        int filled = 0;
+        int w = 0;
+        for (int k = lane; k < BITPACK_BLOCK; k += BITPACK_LANES) {
+            acc |= static_cast<uint64_t>(zz[k]) << filled;
+            filled += bits;
+            if (filled >= 32) {
+                uint32_t word = static_cast<uint32_t>(acc);
+                std::memcpy(out + (w++ * BITPACK_LANES + lane) * sizeof(word), &word, sizeof(word));
+                acc >>= 32;
+                filled -= 32;
+            }
+        }
+    }
+}
+
+static void bitunpack_block(const uint8_t* in, int bits, uint32_t* zz) {
+    uint32_t mask = bits == 32 ? 0xffffffffu : (1u << bits) - 1;
+    for (int lane = 0; lane < BITPACK_LANES; lane++) {
+        uint64_t acc = 0;
+        int avail = 0;
+        int w = 0;
+        for (int k = lane; k < BITPACK_BLOCK; k += BITPACK_LANES) {
+            if (avail < bits) {
+                uint32_t word;
+                std::memcpy(&word, in + (w++ * BITPACK_LANES + lane) * sizeof(word), sizeof(word));
+                acc |= static_cast<uint64_t>(word) << avail;
+                avail += 32;
+            }
+            zz[k] = static_cast<uint32_t>(acc) & mask;
+            acc >>= bits;
+            avail -= bits;
+        }
+    }
+}
+#endif
+
+static size_t delta_bitpack_encode(const int* in, size_t n, uint8_t* out) {
+    uint8_t* op = out;
+    alignas(16) uint32_t zz[BITPACK_BLOCK];
+    uint32_t prev = 0;
+    size_t base = 0;
+    for (; base + BITPACK_BLOCK <= n; base += BITPACK_BLOCK) {
+        uint32_t bits_or = delta_zigzag_block(in + base, prev, zz);
+        prev = static_cast<uint32_t>(in[base + BITPACK_BLOCK - 1]);
+        int bits = bits_or ? 32 - __builtin_clz(bits_or) : 0;
+        *op++ = bits;
+        if (bits == 0) continue;
+        bitpack_block(zz, bits, op);
+        op += BITPACK_BLOCK / 8 * bits;
+    }
+    if (base == n) return op - out;
+
+    // Bloc incomplet : chemin scalaire, ordre des valeurs
+    size_t count = n - base;
+    const uint32_t* block = reinterpret_cast<const uint32_t*>(in + base);
+    uint32_t bits_or = 0;
+    for (size_t k = 0; k < count; k++) {
+        uint32_t delta = block[k] - (k ? block[k - 1] : prev);
+        zz[k] = (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+        bits_or |= zz[k];
+    }
+    int bits = bits_or ? 32 - __builtin_clz(bits_or) : 0;
+    *op++ = bits;
+    if (bits == 0) return op - out;
+    uint64_t acc = 0;
+    int filled = 0;
+    for (size_t k = 0; k < count; k++) {
+        acc |= static_cast<uint64_t>(zz[k]) << filled;
+        filled += bits;
+        if (filled >= 32) {
+            uint32_t word = static_cast<uint32_t>(acc);
+            std::memcpy(op, &word, sizeof(word));
+            op += sizeof(word);
+            acc >>= 32;
+            filled -= 32;
+        }
+    }
+    for (; filled > 0; filled -= 8) {
+        *op++ = static_cast<uint8_t>(acc);
+        acc >>= 8;
+    }
+    return op - out;
+}
+
+// Retourne le nombre d'octets consommés
+static size_t delta_bitpack_decode(const uint8_t* in, size_t n, int* out) {
+    const uint8_t* ip = in;
+    alignas(16) uint32_t zz[BITPACK_BLOCK];
+    uint32_t prev = 0;
+    size_t base = 0;
+    for (; base + BITPACK_BLOCK <= n; base += BITPACK_BLOCK) {
+        int bits = *ip++;
+        if (bits == 0) {
+            std::fill(zz, zz + BITPACK_BLOCK, 0u);
+        } else {
+            bitunpack_block(ip, bits, zz);
+            ip += BITPACK_BLOCK / 8 * bits;
+        }
+        unzigzag_prefix_block(zz, prev, out + base);
+        prev = static_cast<uint32_t>(out[base + BITPACK_BLOCK - 1]);
+    }
+    if (base == n) return ip - in;
+
+    size_t count = n - base;
+    int bits = *ip++;
+    const uint8_t* block_end = ip + (count * bits + 7) / 8;
+    uint32_t mask = bits == 32 ? 0xffffffffu : (1u << bits) - 1;
+    uint64_t acc = 0;
+    int avail = 0;
+    for (size_t k = 0; k < count; k++) {
+        if (avail < bits) {
+            uint32_t word = 0;
+            if (block_end - ip >= 4) {
+                std::memcpy(&word, ip, sizeof(word));
+            } else {
+                std::memcpy(&word, ip, block_end - ip);
+            }
+            acc |= static_cast<uint64_t>(word) << avail;
+            ip += sizeof(word);
+            avail += 32;
+        }
+        zz[k] = static_cast<uint32_t>(acc) & mask;
+        acc >>= bits;
+        avail -= bits;
+    }
+    uint32_t* dst = reinterpret_cast<uint32_t*>(out + base);
+    for (size_t k = 0; k < count; k++) {
+        prev += (zz[k] >> 1) ^ (0u - (zz[k] & 1));
+        dst[k] = prev;
+    }
+    return block_end - in;
+}
+
+// ============================================================================
+// Codec LZ77 rapide (famille LZ4) sur octets
+// Séquence : token (littéraux << 4 | match - LZ_MIN_MATCH), extensions de
+// longueur par octets 255, littéraux, offset 16 bits, extension du match.
+// La dernière séquence ne contient que des littéraux.
+// ============================================================================
+#define LZ_HASH_BITS 14
+#define LZ_MIN_MATCH 4
+
+static inline uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint8_t* lz_write_length(uint8_t* op, size_t len) {
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = static_cast<uint8_t>(len);
+    return op;
+}
+
+static uint8_t* lz_write_literals(uint8_t* op, const uint8_t* src, size_t lit, size_t match_code) {
+    *op++ = static_cast<uint8_t>(std::min<size_t>(lit, 15) << 4 | std::min<size_t>(match_code, 15));
+    if (lit >= 15) op = lz_write_length(op, lit - 15);
+    std::memcpy(op, src, lit);
+    return op + lit;
+}
+
+static size_t lz_bound(size_t bytes) {
+    return bytes + bytes / 255 + 16;
+}
+
+// `table` : 2^LZ_HASH_BITS positions, réutilisée entre les appels
+static size_t lz_compress(const uint8_t* src, size_t n, uint8_t* out, std::vector<uint32_t>& table) {
+    uint8_t* op = out;
+    table.assign(1 << LZ_HASH_BITS, UINT32_MAX);
+    size_t anchor = 0;
+    size_t i = 0;
+    while (n >= LZ_MIN_MATCH + 8 && i <= n - LZ_MIN_MATCH - 8) {
+        uint32_t seq = load_u32(src + i);
+        uint32_t h = (seq * 2654435761u) >> (32 - LZ_HASH_BITS);
+        uint32_t cand = table[h];
+        table[h] = i;
+        if (cand != UINT32_MAX && i - cand <= 65535 && load_u32(src + cand) == seq) {
+            size_t len = LZ_MIN_MATCH;
+            while (i + len < n && src[cand + len] == src[i + len]) len++;
+            op = lz_write_literals(op, src + anchor, i - anchor, len - LZ_MIN_MATCH);
+            uint16_t offset = i - cand;
+            std::memcpy(op, &offset, sizeof(offset));
+            op += sizeof(offset);
+            if (len - LZ_MIN_MATCH >= 15) op = lz_write_length(op, len - LZ_MIN_MATCH - 15);
+            i += len;
+            anchor = i;
+        } else {
+            // Accélère sur les zones incompressibles
+            i += 1 + ((i - anchor) >> 6);
+        }
+    }
+    op = lz_write_literals(op, src + anchor, n - anchor, 0);
+    return op - out;
+}
+
+// Retourne le nombre d'octets consommés ; `n` = taille décompressée
+static size_t lz_decompress(const uint8_t* in, uint8_t* dst, size_t n) {
+    const uint8_t* ip = in;
+    uint8_t* op = dst;
+    uint8_t* end = dst + n;
+    for (;;) {
+        uint8_t token = *ip++;
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do { b = *ip++; lit += b; } while (b == 255);
+        }
+        std::memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (op >= end) break;
+
+        uint16_t offset;
+        std::memcpy(&offset, ip, sizeof(offset));
+        ip += sizeof(offset);
+        size_t len = (token & 15) + LZ_MIN_MATCH;
+        if ((token & 15) == 15) {
+            uint8_t b;
+            do { b = *ip++; len += b; } while (b == 255);
+        }
+        // Match chevauchant : le motif de période `offset` est recopié par blocs doublants
+        size_t dist = offset;
+        while (len > 0) {
+            size_t chunk = std::min(len, dist);
+            std::memcpy(op, op - dist, chunk);
+            op += chunk;
+            len -= chunk;
+            dist += chunk;
+        }
+    }
+    return ip - in;
+}
+
+// ============================================================================
+// Benchmark Compressed MPI - compression sur le root, MPI_Bcast du flux
+// compressé, décompression sur les receveurs (les deux sont chronométrées)
+// Args: {outer_size, base_size, content (ContentKind), codec (CompressionCodec)}
+// CODEC_NONE diffuse sans copie avec la stratégie bcast (référence).
+// ============================================================================
+enum CompressionCodec {
+    CODEC_NONE = 0,
+    CODEC_DELTA_BITPACK = 1,
+    CODEC_LZ = 2
+};
+
+static const char* const codec_names[] = {"none", "delta_bitpack", "lz"};
+
+static size_t codec_bound(CompressionCodec codec, size_t n) {
+    return codec == CODEC_LZ ? lz_bound(n * sizeof(int)) : delta_bitpack_bound(n);
+}
+
+static size_t codec_encode(CompressionCodec codec, const int* in, size_t n, uint8_t* out, std::vector<uint32_t>& table) {
+    if (codec == CODEC_LZ) {
+        return lz_compress(reinterpret_cast<const uint8_t*>(in), n * sizeof(int), out, table);
+    }
+    return delta_bitpack_encode(in, n, out);
+}
+
+static size_t codec_decode(CompressionCodec codec, const uint8_t* in, size_t n, int* out) {
+    if (codec == CODEC_LZ) {
+        return lz_decompress(in, reinterpret_cast<uint8_t*>(out), n * sizeof(int));
+    }
+    return delta_bitpack_decode(in, n, out);
+}
+
+static void BM_CompressedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    ContentKind content = static_cast<ContentKind>(state.range(2));
+    CompressionCodec codec = static_cast<CompressionCodec>(state.range(3));
+    int inner_iters = get_inner_iterations(base_size_param);
+
+    VectorOfVectors vec(outer_size_param, base_size_param);
+    fill_content(vec, content);
+    state.SetLabel(std::string(content_names[content]) + "/" + codec_names[codec]);
+
+    std::vector<uint8_t> wire;
+    std::vector<uint32_t> lz_table;
+    if (g_rank == 0 && codec != CODEC_NONE) {
+        size_t bound = 0;
+        for (const auto& inner : vec.data) {
+            bound += codec_bound(codec, inner.size());
+        }
+        wire.resize(bound);
+    }
+
+    double time_total = 0.0;
+    double encode_time = 0.0;
+    double decode_time = 0.0;
+    long wire_bytes = 0;
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (codec == CODEC_NONE) {
+                if (g_rank == 0) {
+                    nested_bcast(MPI_COMM_WORLD, vec.data, 0);
+                } else {
+                    VectorOfVectors recv_vec;
+                    nested_bcast(MPI_COMM_WORLD, recv_vec.data, 0);
+                }
+                wire_bytes = static_cast<long>(vec.total_elements()) * sizeof(int);
+                continue;
+            }
+
+            // En-tête : outer_size, octets compressés, puis tailles internes
+            int header[2] = {0, 0};
+            std::vector<int> inner_sizes;
+            if (g_rank == 0) {
+                double t0 = MPI_Wtime();
+                size_t position = 0;
+                for (const auto& inner : vec.data) {
+                    position += codec_encode(codec, inner.data(), inner.size(), wire.data() + position, lz_table);
+                }
+                encode_time += MPI_Wtime() - t0;
+                header[0] = vec.data.size();
+                header[1] = position;
+                inner_sizes.resize(header[0]);
+                for (int j = 0; j < header[0]; j++) {
+                    inner_sizes[j] = vec.data[j].size();
+                }
+            }
+            MPI_Bcast(header, 2, MPI_INT, 0, MPI_COMM_WORLD);
+            inner_sizes.resize(header[0]);
+            MPI_Bcast(inner_sizes.data(), header[0], MPI_INT, 0, MPI_COMM_WORLD);
+            if (g_rank != 0) {
+                wire.resize(header[1]);
+            }
+            MPI_Bcast(wire.data(), header[1], MPI_BYTE, 0, MPI_COMM_WORLD);
+            wire_bytes = header[1];
+
+            if (g_rank != 0) {
+                double t0 = MPI_Wtime();
+                VectorOfVectors recv_vec;
+                recv_vec.data.resize(header[0]);
+                size_t position = 0;
+                for (int j = 0; j < header[0]; j++) {
+                    recv_vec.data[j].resize(inner_sizes[j]);
+                    position += codec_decode(codec, wire.data() + position, inner_sizes[j], recv_vec.data[j].data());
+                }
+                decode_time += MPI_Wtime() - t0;
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+        time_total += max_per_op;
+    }
+
+    // Bande passante effective (données décompressées) et sur le lien (octets compressés)
+    double ops = static_cast<double>(state.iterations()) * inner_iters;
+    double per_op = time_total / state.iterations();
+    double payload = static_cast<double>(vec.total_elements()) * sizeof(int);
+    double times[2] = {encode_time / ops, decode_time / ops};
+    double max_times[2];
+    MPI_Allreduce(times, max_times, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    state.counters["ratio"] = wire_bytes > 0 ? payload / wire_bytes : 0.0;
+    state.counters["effective_bw"] = benchmark::Counter(payload / per_op, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.counters["wire_bw"] = benchmark::Counter(wire_bytes / per_op, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.counters["encode_us"] = max_times[0] * 1e6;
+    state.counters["decode_us"] = max_times[1] * 1e6;
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Benchmark Ragged MPI - formes irrégulières avec 10^4 à 10^6 vecteurs internes
+// Le coût par message domine : les stratégies nested_* utilisent un tag unique
+// et une fenêtre de requêtes bornée (RequestWindow).
+// Args: {outer_size, mean_size, shape (ShapeKind), strategy (NestedStrategy)}
+// ============================================================================
+#define RAGGED_MESSAGE_COST 1024
+
+static void BM_RaggedMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int mean_size_param = state.range(1);
+    ShapeKind shape = static_cast<ShapeKind>(state.range(2));
+    NestedStrategyFn strategy = nested_strategy_fn<BufferVector<int>>(state.range(3));
+
+    std::vector<int> inner_sizes = make_ragged_shape(outer_size_param, mean_size_param, shape);
+    VectorOfVectors vec(inner_sizes);
+    // Itérations internes d'après le coût estimé, ramené à l'échelle base_size des configurations :
+    // volume total + un surcoût fixe de RAGGED_MESSAGE_COST éléments par vecteur
+    long cost = vec.total_elements() + static_cast<long>(outer_size_param) * RAGGED_MESSAGE_COST;
+    int inner_iters = get_inner_iterations(std::min<long>(cost / 55, std::numeric_limits<int>::max()));
+    int empty = std::count(inner_sizes.begin(), inner_sizes.end(), 0);
+    state.SetLabel(std::string(shape_names[shape]) + "/" + nested_strategy_names[state.range(3)]);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+
+        for (int iter = 0; iter < inner_iters; iter++) {
+            if (g_rank == 0) {
+                strategy(MPI_COMM_WORLD, vec.data, 0);
+            } else {
+                VectorOfVectors recv_vec;
+                strategy(MPI_COMM_WORLD, recv_vec.data, 0);
+            }
+        }
+
+        // Synchronisation finale
+        if (g_rank == 0) {
+            int ack;
+            for (int dest = 1; dest < g_size; dest++) {
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+        } else {
+            int ack = 1;
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
+        }
+
+        double elapsed = MPI_Wtime() - start;
+        double per_op = elapsed / inner_iters;
+        double max_per_op;
+        MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(max_per_op);
+    }
+    state.counters["empty_vectors"] = empty;
+    state.counters["max_inner"] = *std::max_element(inner_sizes.begin(), inner_sizes.end());
+    SetBytesProcessed(state, vec, inner_iters);
+}
+
+// ============================================================================
+// Stratégie hybride : les vecteurs de moins de `threshold` éléments sont
+// regroupés avec l'en-tête des tailles dans un seul buffer agrégé, les autres
+// partent sans copie, un message chacun, postés à la suite de l'agrégat.
+// Agrégat (ints) : [inner_sizes[outer_size]][données des petits vecteurs]
+// ============================================================================
+enum HybridTransport {
+    HYBRID_BCAST = 0,  // MPI_Ibcast
+    HYBRID_P2P = 1     // MPI_Isend/MPI_Irecv depuis le root
+};
+
+struct HybridStats {
+    long messages = 0;      // messages (ou collectives) postés par ce rank
+    long copied_bytes = 0;  // octets copiés vers/depuis l'agrégat par ce rank
+};
+
+static void nested_hybrid(MPI_Comm comm, VectorOfVectors& vec, int root, int threshold,
+                          HybridTransport transport, HybridStats& stats) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int peers = transport == HYBRID_P2P && rank == root ? size - 1 : 1;
+
+    // En-tête : outer_size, longueur de l'agrégat
+    int header[2] = {0, 0};
+    std::vector<int> aggregate;
+    if (rank == root) {
+        int outer_size = vec.data.size();
+        aggregate.resize(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            aggregate[j] = vec.data[j].size();
+        }
+        for (int j = 0; j < outer_size; j++) {
+            if (aggregate[j] < threshold) {
+                aggregate.insert(aggregate.end(), vec.data[j].begin(), vec.data[j].end());
+            }
+        }
+        stats.copied_bytes += (aggregate.size() - outer_size) * sizeof(int);
+        count_copy((aggregate.size() - outer_size) * sizeof(int));
+        header[0] = outer_size;
+        header[1] = aggregate.size();
+    }
+
+    RequestWindow window;
+    if (transport == HYBRID_BCAST) {
+        MPI_Bcast(header, 2, MPI_INT, root, comm);
+        aggregate.resize(header[1]);
+        MPI_Ibcast(aggregate.data(), header[1], MPI_INT, root, comm, window.next());
+    } else if (rank == root) {
+        for (int dest = 0; dest < size; dest++) {
+            if (dest == root) continue;
+            MPI_Isend(header, 2, MPI_INT, dest, 0, comm, window.next());
+            MPI_Isend(aggregate.data(), header[1], MPI_INT, dest, 1, comm, window.next());
+        }
+    } else {
+        MPI_Recv(header, 2, MPI_INT, root, 0, comm, MPI_STATUS_IGNORE);
+        aggregate.resize(header[1]);
+        MPI_Irecv(aggregate.data(), header[1], MPI_INT, root, 1, comm, window.next());
+    }
+    stats.messages += 2 * peers;
+
+    // Les receveurs ont besoin des tailles (dans l'agrégat) avant de poster les gros vecteurs
+    if (rank != root) {
+        window.wait_all();
+        vec.data.resize(header[0]);
+    }
+    int outer_size = header[0];
+    const int* small_data = aggregate.data() + outer_size;
+    for (int j = 0; j < outer_size; j++) {
+        int inner_size = aggregate[j];
+        if (rank != root) {
+            vec.data[j].resize(inner_size);
+        }
+        if (inner_size < threshold) {
+            if (rank != root) {
+                std::memcpy(vec.data[j].data(), small_data, inner_size * sizeof(int));
+                stats.copied_bytes += inner_size * sizeof(int);
+                count_copy(inner_size * sizeof(int));
+            }
+            small_data += inner_size;
+            continue;
+        }
+        if (transport == HYBRID_BCAST) {
+            MPI_Ibcast(vec.data[j].data(), inner_size, MPI_INT, root, comm, window.next());
+        } else if (rank == root) {
+            for (int dest = 0; dest < size; dest++) {
+                if (dest == root) continue;
+                MPI_Isend(vec.data[j].data(), inner_size, MPI_INT, dest, TAG_DATA, comm, window.next());
+            }
+        } else {
+            MPI_Irecv(vec.data[j].data(), inner_size, MPI_INT, root, TAG_DATA, comm, window.next());
+        }
+        stats.messages += peers;
+    }
+    window.wait_all();
+}
+
+// ============================================================================
+// Benchmark Hybrid MPI - nested_hybrid sur les formes irrégulières
+// threshold = 0 : un message par vecteur (comme Bcast/Raw) ;
+// threshold > taille max : tout est copié dans l'agrégat (comme Pack)
+// Args: {outer_size, mean_size, shape (ShapeKind), threshold (éléments), transport (HybridTransport)}
+// ============================================================================
+static void BM_HybridMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int mean_size_param = state.range(1);
+    ShapeKind shape = static_cast<ShapeKind>(state.range(2));
+    int threshold = state.range(3);
+    HybridTransport transport = static_cast<HybridTransport>(state.range(4));
 
-    boost::mpi::communicator world;
-    VectorOfVectors vec(outer_size_param, base_size_param);
+    MemoryProbe memory;
+    std::vector<int> inner_sizes = make_ragged_shape(outer_size_param, mean_size_param, shape);
+    VectorOfVectors vec(inner_sizes);
+    long cost = vec.total_elements() + static_cast<long>(outer_size_param) * RAGGED_MESSAGE_COST;
+    int inner_iters = get_inner_iterations(std::min<long>(cost / 55, std::numeric_limits<int>::max()));
+    state.SetLabel(std::string(shape_names[shape]) + (transport == HYBRID_BCAST ? "/bcast" : "/p2p"));
 
+    HybridStats stats;
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
             if (g_rank == 0) {
-                for (int dest = 1; dest < g_size; dest++) {
-                    world.send(dest, 0, vec);
-                }
+                nested_hybrid(MPI_COMM_WORLD, vec, 0, threshold, transport, stats);
             } else {
                 VectorOfVectors recv_vec;
-                world.recv(0, 0, recv_vec);
+                nested_hybrid(MPI_COMM_WORLD, recv_vec, 0, threshold, transport, stats);
             }
         }
 
@@ -517,11 +4880,11 @@ static void BM_BoostMPI(benchmark::State& state) {
         if (g_rank == 0) {
             int ack;
             for (int dest = 1; dest < g_size; dest++) {
-                world.recv(dest, 1, ack);
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
             }
         } else {
             int ack = 1;
-            world.send(0, 1, ack);
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
         }
 
         double elapsed = MPI_Wtime() - start;
@@ -530,47 +4893,73 @@ static void BM_BoostMPI(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
+
+    // Par opération, maximum sur les ranks (le root en P2P, qui poste un message par destination)
+    double ops = static_cast<double>(state.iterations()) * inner_iters;
+    double per_op[2] = {stats.messages / ops, stats.copied_bytes / ops};
+    double max_per_op[2];
+    MPI_Allreduce(per_op, max_per_op, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    state.counters["messages"] = max_per_op[0];
+    state.counters["copied_bytes"] = benchmark::Counter(max_per_op[1], benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    memory.report(state, inner_iters);
     SetBytesProcessed(state, vec, inner_iters);
 }
 
+// Vrai si chaque nœud a assez de mémoire disponible (MemAvailable) pour
+// `bytes_per_rank` octets sur chacun de ses ranks, avec 10 % de marge. Collectif.
+static bool memory_available(double bytes_per_rank) {
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, g_rank, MPI_INFO_NULL, &node_comm);
+    int node_size;
+    MPI_Comm_size(node_comm, &node_size);
+    MPI_Comm_free(&node_comm);
+
+    double available = 0.0;
+    std::ifstream meminfo("/proc/meminfo");
+    std::string key;
+    double value;
+    std::string unit;
+    while (meminfo >> key >> value >> unit) {
+        if (key == "MemAvailable:") {
+            available = value * 1024.0;
+            break;
+        }
+    }
+    int enough = available >= bytes_per_rank * node_size * 1.1;
+    MPI_Allreduce(MPI_IN_PLACE, &enough, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+    return enough;
+}
+
 // ============================================================================
-// Benchmark Boost Packed MPI
+// Benchmark Large Bcast MPI 1D - buffer contigu de plus de 2^31 éléments/octets
 // ============================================================================
-static void BM_BoostPackedMPI(benchmark::State& state) {
-    int outer_size_param = state.range(0);
-    int base_size_param = state.range(1);
-    int inner_iters = get_inner_iterations(base_size_param);
+static void BM_LargeBcastMPI_1D(benchmark::State& state) {
+    int64_t array_size = state.range(0);
+    int inner_iters = get_inner_iterations_1d(array_size);
 
-    boost::mpi::communicator world;
-    VectorOfVectors vec(outer_size_param, base_size_param);
+    if (!memory_available(static_cast<double>(array_size) * sizeof(int))) {
+        state.SkipWithError("BM_LargeBcastMPI_1D: not enough memory available on the node");
+        return;
+    }
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
 
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
-            if (g_rank == 0) {
-                boost::mpi::packed_oarchive::buffer_type buffer;
-                boost::mpi::packed_oarchive oa(world, buffer);
-                oa << vec;
-                for (int dest = 1; dest < g_size; dest++) {
-                    world.send(dest, 0, buffer);
-                }
-            } else {
-                VectorOfVectors recv_vec;
-                world.recv(0, 0, recv_vec);
-            }
+            large_bcast(buffer.data(), array_size, MPI_INT, 0, MPI_COMM_WORLD);
         }
 
         // Synchronisation finale
         if (g_rank == 0) {
             int ack;
             for (int dest = 1; dest < g_size; dest++) {
-                world.recv(dest, 1, ack);
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
             }
         } else {
             int ack = 1;
-            world.send(0, 1, ack);
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
         }
 
         double elapsed = MPI_Wtime() - start;
@@ -579,53 +4968,36 @@ static void BM_BoostPackedMPI(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
-    SetBytesProcessed(state, vec, inner_iters);
-}
-
-// ============================================================================
-// Benchmarks 1D - Mesure du coût de communication pur (buffer contigu)
-// ============================================================================
-
-// Helper pour obtenir les inner iterations pour 1D basé sur la taille du tableau
-// Tailles équivalentes aux benchmarks 2D (base_size * 55)
-inline int get_inner_iterations_1d(int array_size) {
-    if (array_size <= 2750) return INNER_ITERATIONS_SMALL;        // ~11 KB
-    if (array_size <= 27500) return INNER_ITERATIONS_MEDIUM;      // ~107 KB
-    if (array_size <= 275000) return INNER_ITERATIONS_LARGE;      // ~1 MB
-    if (array_size <= 2750000) return INNER_ITERATIONS_XLARGE;    // ~10 MB
-    if (array_size <= 27500000) return INNER_ITERATIONS_XXLARGE;  // ~105 MB
-    return INNER_ITERATIONS_XXXLARGE;                              // ~420 MB
-}
-
-// Helper pour SetBytesProcessed pour 1D
-static void SetBytesProcessed1D(benchmark::State& state, int array_size, int inner_iters) {
-    state.SetBytesProcessed(state.iterations() * inner_iters * array_size * sizeof(int));
+    SetBytesProcessed1D(state, array_size, inner_iters);
 }
 
 // ============================================================================
-// Benchmark Raw MPI 1D - Point-to-point avec buffer contigu
+// Benchmark Large Raw MPI 1D - point-à-point, même découpage
 // ============================================================================
-static void BM_RawMPI_1D(benchmark::State& state) {
-    int array_size = state.range(0);
+static void BM_LargeRawMPI_1D(benchmark::State& state) {
+    int64_t array_size = state.range(0);
     int inner_iters = get_inner_iterations_1d(array_size);
 
-    std::vector<int> send_buffer(array_size, 42);
-    std::vector<int> recv_buffer(array_size);
+    if (!memory_available(static_cast<double>(array_size) * sizeof(int))) {
+        state.SkipWithError("BM_LargeRawMPI_1D: not enough memory available on the node");
+        return;
+    }
+    BufferVector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
 
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
+            RequestWindow window;
             if (g_rank == 0) {
-                std::vector<MPI_Request> requests(g_size - 1);
                 for (int dest = 1; dest < g_size; dest++) {
-                    MPI_Isend(send_buffer.data(), array_size, MPI_INT, dest, 0, MPI_COMM_WORLD, &requests[dest - 1]);
+                    large_isend(buffer.data(), array_size, MPI_INT, dest, TAG_DATA, MPI_COMM_WORLD, window);
                 }
-                MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
             } else {
-                MPI_Recv(recv_buffer.data(), array_size, MPI_INT, 0, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                large_irecv(buffer.data(), array_size, MPI_INT, 0, TAG_DATA, MPI_COMM_WORLD, window);
             }
+            window.wait_all();
         }
 
         // Synchronisation finale
@@ -649,20 +5021,52 @@ static void BM_RawMPI_1D(benchmark::State& state) {
 }
 
 // ============================================================================
-// Benchmark Bcast MPI 1D - Broadcast collectif avec buffer contigu
+// Benchmark Large Bcast MPI - 2D au-delà de 2^31 éléments au total
+// En-tête en int64 (MPI_INT64_T), un large_bcast par vecteur interne
 // ============================================================================
-static void BM_BcastMPI_1D(benchmark::State& state) {
-    int array_size = state.range(0);
-    int inner_iters = get_inner_iterations_1d(array_size);
+static void BM_LargeBcastMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int base_size_param = state.range(1);
+    int inner_iters = get_inner_iterations(base_size_param);
 
-    std::vector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+    // 1 + 4 + 9 + ... + outer² vecteurs de base_size éléments
+    double total_bytes = 0.0;
+    for (int i = 0; i < outer_size_param; i++) {
+        total_bytes += static_cast<double>(base_size_param) * (i + 1) * (i + 1) * sizeof(int);
+    }
+    if (!memory_available(total_bytes)) {
+        state.SkipWithError("BM_LargeBcastMPI: not enough memory available on the node");
+        return;
+    }
+    VectorOfVectors vec;
+    if (g_rank == 0) {
+        vec = VectorOfVectors(outer_size_param, base_size_param);
+    }
 
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
-            MPI_Bcast(buffer.data(), array_size, MPI_INT, 0, MPI_COMM_WORLD);
+            int64_t outer_size = vec.data.size();
+            MPI_Bcast(&outer_size, 1, MPI_INT64_T, 0, MPI_COMM_WORLD);
+            std::vector<int64_t> inner_sizes(outer_size);
+            if (g_rank == 0) {
+                for (int64_t j = 0; j < outer_size; j++) {
+                    inner_sizes[j] = vec.data[j].size();
+                }
+            }
+            MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT64_T, 0, MPI_COMM_WORLD);
+            // Les receveurs réutilisent leur buffer : seule la mémoire d'une copie est disponible
+            if (g_rank != 0) {
+                vec.data.resize(outer_size);
+                for (int64_t j = 0; j < outer_size; j++) {
+                    vec.data[j].resize(inner_sizes[j]);
+                }
+            }
+            for (int64_t j = 0; j < outer_size; j++) {
+                large_bcast(vec.data[j].data(), inner_sizes[j], MPI_INT, 0, MPI_COMM_WORLD);
+            }
         }
 
         // Synchronisation finale
@@ -682,37 +5086,292 @@ static void BM_BcastMPI_1D(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
-    SetBytesProcessed1D(state, array_size, inner_iters);
+    SetBytesProcessed(state, vec, inner_iters);
 }
 
 // ============================================================================
-// Benchmark RDMA MPI 1D - One-sided avec buffer contigu
+// Échange tous-vers-tous de données irrégulières
+// Chaque rank possède son propre VectorOfVectors (forme et volume différents)
+// et reçoit ceux des autres : concaténation dans l'ordre des ranks
+// (allgather) ou bloc personnalisé par destinataire (alltoall).
+// Trois transports pour les mêmes phases :
+//   - collectives bloquantes
+//   - collectives non bloquantes (MPI_I*), attendues phase par phase
+//   - collectives de voisinage (MPI_Ineighbor_*) sur un graphe complet avec
+//     boucle sur soi, les voisins étant dans l'ordre des ranks
 // ============================================================================
-static void BM_RDMAMPI_1D(benchmark::State& state) {
-    int array_size = state.range(0);
-    int inner_iters = get_inner_iterations_1d(array_size);
+enum ExchangeMode {
+    EXCHANGE_BLOCKING,
+    EXCHANGE_NONBLOCKING,
+    EXCHANGE_NEIGHBOR
+};
 
-    std::vector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
-    MPI_Win win;
+enum ExchangeMethod {
+    EXCHANGE_ALLGATHERV = 0,
+    EXCHANGE_IALLGATHERV = 1,
+    EXCHANGE_NEIGHBOR_ALLGATHERV = 2,
+    EXCHANGE_ALLTOALLV = 3,
+    EXCHANGE_IALLTOALLV = 4,
+    EXCHANGE_NEIGHBOR_ALLTOALLV = 5,
+    EXCHANGE_BOOST_ALL_GATHER = 6
+};
 
-    if (g_rank == 0) {
-        MPI_Win_create(buffer.data(), array_size * sizeof(int), sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
-    } else {
-        MPI_Win_create(nullptr, 0, sizeof(int), MPI_INFO_NULL, MPI_COMM_WORLD, &win);
+static const char* exchange_names[] = {"allgatherv", "iallgatherv", "neighbor_allgatherv", "alltoallv",
+                                       "ialltoallv", "neighbor_alltoallv", "boost_all_gather"};
+
+// Données reçues, dans l'ordre des ranks sources
+struct ExchangeResult {
+    std::vector<int> counts;       // vecteurs reçus de chaque rank
+    std::vector<int> inner_sizes;  // leurs tailles, concaténées
+    std::vector<int> values;       // leurs données, concaténées
+
+    // Éléments reçus des autres ranks (le bloc de `self` reste local)
+    long remote_elements(int self) const {
+        long total = 0;
+        int k = 0;
+        for (int r = 0; r < static_cast<int>(counts.size()); r++) {
+            for (int j = 0; j < counts[r]; j++, k++) {
+                if (r != self) total += inner_sizes[k];
+            }
+        }
+        return total;
+    }
+};
+
+// Graphe complet avec boucle sur soi : les collectives de voisinage
+// retrouvent exactement la disposition des collectives globales
+static MPI_Comm create_complete_graph(MPI_Comm comm) {
+    int size;
+    MPI_Comm_size(comm, &size);
+    std::vector<int> neighbors(size);
+    for (int r = 0; r < size; r++) {
+        neighbors[r] = r;
+    }
+    MPI_Comm graph;
+    MPI_Dist_graph_create_adjacent(comm, size, neighbors.data(), MPI_UNWEIGHTED, size, neighbors.data(),
+                                   MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &graph);
+    return graph;
+}
+
+static void exchange_allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                               MPI_Datatype recvtype, MPI_Comm comm, ExchangeMode mode) {
+    MPI_Request request;
+    switch (mode) {
+    case EXCHANGE_BLOCKING:
+        MPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+        return;
+    case EXCHANGE_NONBLOCKING:
+        MPI_Iallgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, &request);
+        break;
+    case EXCHANGE_NEIGHBOR:
+        MPI_Ineighbor_allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, &request);
+        break;
+    }
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+static void exchange_allgatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf,
+                                const int* recvcounts, const int* displs, MPI_Datatype recvtype, MPI_Comm comm,
+                                ExchangeMode mode) {
+    MPI_Request request;
+    switch (mode) {
+    case EXCHANGE_BLOCKING:
+        MPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
+        return;
+    case EXCHANGE_NONBLOCKING:
+        MPI_Iallgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, &request);
+        break;
+    case EXCHANGE_NEIGHBOR:
+        MPI_Ineighbor_allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm, &request);
+        break;
+    }
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+static void exchange_alltoall(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                              MPI_Datatype recvtype, MPI_Comm comm, ExchangeMode mode) {
+    MPI_Request request;
+    switch (mode) {
+    case EXCHANGE_BLOCKING:
+        MPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+        return;
+    case EXCHANGE_NONBLOCKING:
+        MPI_Ialltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, &request);
+        break;
+    case EXCHANGE_NEIGHBOR:
+        MPI_Ineighbor_alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm, &request);
+        break;
+    }
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+static void exchange_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, void* recvbuf,
+                               const int* recvcounts, const int* rdispls, MPI_Comm comm, ExchangeMode mode) {
+    MPI_Request request;
+    switch (mode) {
+    case EXCHANGE_BLOCKING:
+        MPI_Alltoallv(sendbuf, sendcounts, sdispls, MPI_INT, recvbuf, recvcounts, rdispls, MPI_INT, comm);
+        return;
+    case EXCHANGE_NONBLOCKING:
+        MPI_Ialltoallv(sendbuf, sendcounts, sdispls, MPI_INT, recvbuf, recvcounts, rdispls, MPI_INT, comm, &request);
+        break;
+    case EXCHANGE_NEIGHBOR:
+        MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, MPI_INT, recvbuf, recvcounts, rdispls, MPI_INT, comm,
+                                &request);
+        break;
+    }
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+// Décalages (préfixe exclusif) de `counts`, renvoie la somme
+static int exclusive_scan(const std::vector<int>& counts, std::vector<int>& displs) {
+    displs.resize(counts.size());
+    int total = 0;
+    for (size_t r = 0; r < counts.size(); r++) {
+        displs[r] = total;
+        total += counts[r];
+    }
+    return total;
+}
+
+// Allgather des nombres de vecteurs, puis allgatherv des tailles et des données.
+// Les données partent sans copie (MPI_BOTTOM + flat_range_type).
+static void exchange_allgatherv_nested(MPI_Comm comm, VectorOfVectors& vec, ExchangeResult& result, ExchangeMode mode) {
+    int size;
+    MPI_Comm_size(comm, &size);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    for (int j = 0; j < outer_size; j++) {
+        inner_sizes[j] = vec.data[j].size();
+    }
+
+    result.counts.resize(size);
+    exchange_allgather(&outer_size, 1, MPI_INT, result.counts.data(), 1, MPI_INT, comm, mode);
+    std::vector<int> displs;
+    result.inner_sizes.resize(exclusive_scan(result.counts, displs));
+    exchange_allgatherv(inner_sizes.data(), outer_size, MPI_INT, result.inner_sizes.data(), result.counts.data(),
+                        displs.data(), MPI_INT, comm, mode);
+
+    std::vector<int> data_counts(size, 0);
+    for (int r = 0, k = 0; r < size; r++) {
+        for (int j = 0; j < result.counts[r]; j++, k++) {
+            data_counts[r] += result.inner_sizes[k];
+        }
+    }
+    std::vector<int> data_displs;
+    result.values.resize(exclusive_scan(data_counts, data_displs));
+    MPI_Datatype send_type = flat_range_type(vec.data, 0, vec.total_elements());
+    exchange_allgatherv(MPI_BOTTOM, 1, send_type, result.values.data(), data_counts.data(), data_displs.data(),
+                        MPI_INT, comm, mode);
+    MPI_Type_free(&send_type);
+}
+
+// Échange personnalisé : le rank d reçoit le bloc de vecteurs
+// [d * outer / P, (d + 1) * outer / P) de chaque rank. Alltoallv n'accepte qu'un
+// datatype d'envoi : tailles et données sont copiées dans l'ordre des destinataires.
+static void exchange_alltoallv_nested(MPI_Comm comm, VectorOfVectors& vec, ExchangeResult& result, ExchangeMode mode) {
+    int size;
+    MPI_Comm_size(comm, &size);
+    int outer_size = vec.data.size();
+    std::vector<int> inner_sizes(outer_size);
+    std::vector<int> flat(vec.total_elements());
+    std::vector<int> send_counts(size), send_displs(size), send_data_counts(size), send_data_displs(size);
+    int offset = 0;
+    for (int d = 0; d < size; d++) {
+        int begin = static_cast<long>(d) * outer_size / size;
+        int end = static_cast<long>(d + 1) * outer_size / size;
+        send_counts[d] = end - begin;
+        send_displs[d] = begin;
+        send_data_displs[d] = offset;
+        for (int j = begin; j < end; j++) {
+            inner_sizes[j] = vec.data[j].size();
+            std::copy(vec.data[j].begin(), vec.data[j].end(), flat.begin() + offset);
+            offset += inner_sizes[j];
+        }
+        send_data_counts[d] = offset - send_data_displs[d];
+    }
+    count_copy(static_cast<long>(flat.size()) * sizeof(int));
+
+    result.counts.resize(size);
+    exchange_alltoall(send_counts.data(), 1, MPI_INT, result.counts.data(), 1, MPI_INT, comm, mode);
+    std::vector<int> recv_displs;
+    result.inner_sizes.resize(exclusive_scan(result.counts, recv_displs));
+    exchange_alltoallv(inner_sizes.data(), send_counts.data(), send_displs.data(), result.inner_sizes.data(),
+                       result.counts.data(), recv_displs.data(), comm, mode);
+
+    std::vector<int> recv_data_counts(size, 0);
+    for (int r = 0, k = 0; r < size; r++) {
+        for (int j = 0; j < result.counts[r]; j++, k++) {
+            recv_data_counts[r] += result.inner_sizes[k];
+        }
     }
+    std::vector<int> recv_data_displs;
+    result.values.resize(exclusive_scan(recv_data_counts, recv_data_displs));
+    exchange_alltoallv(flat.data(), send_data_counts.data(), send_data_displs.data(), result.values.data(),
+                       recv_data_counts.data(), recv_data_displs.data(), comm, mode);
+}
+
+// ============================================================================
+// Benchmark Exchange MPI - chaque rank contribue ses données et reçoit celles des autres
+// Args: {outer, mean, shape, method} ; le rank r tire sa forme avec une
+// moyenne de mean * (2r + 1) / P éléments (moyenne globale = mean).
+// bytes_per_second = débit agrégé : octets reçus des autres ranks, sommés sur tous les ranks.
+// Avec --memory_counters, copied_bytes montre la copie de préparation des
+// méthodes alltoallv, absente des méthodes allgatherv (envoi sans copie).
+// ============================================================================
+static void BM_ExchangeMPI(benchmark::State& state) {
+    int outer_size_param = state.range(0);
+    int mean_size_param = state.range(1);
+    ShapeKind shape = static_cast<ShapeKind>(state.range(2));
+    ExchangeMethod method = static_cast<ExchangeMethod>(state.range(3));
 
-    std::vector<int> recv_buffer(array_size);
+    int own_mean = std::max<long>(1, static_cast<long>(mean_size_param) * (2 * g_rank + 1) / g_size);
+    std::vector<int> inner_sizes = make_ragged_shape(outer_size_param, own_mean, shape, 12345 + g_rank);
+    VectorOfVectors vec(inner_sizes);
+    // Volume reçu par rank ~ outer * mean * P
+    long cost = static_cast<long>(outer_size_param) * mean_size_param * g_size;
+    int inner_iters = get_inner_iterations(std::min<long>(cost / 55, std::numeric_limits<int>::max()));
+    MemoryProbe memory;
+    state.SetLabel(std::string(shape_names[shape]) + "/" + exchange_names[method]);
+
+    boost::mpi::communicator world;
+    MPI_Comm graph = MPI_COMM_NULL;
+    if (method == EXCHANGE_NEIGHBOR_ALLGATHERV || method == EXCHANGE_NEIGHBOR_ALLTOALLV) {
+        graph = create_complete_graph(MPI_COMM_WORLD);
+    }
+    ExchangeResult result;
+    std::vector<VectorOfVectors> gathered;
 
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
         for (int iter = 0; iter < inner_iters; iter++) {
-            MPI_Win_fence(0, win);
-            if (g_rank != 0) {
-                MPI_Get(recv_buffer.data(), array_size, MPI_INT, 0, 0, array_size, MPI_INT, win);
+            switch (method) {
+            case EXCHANGE_ALLGATHERV:
+                exchange_allgatherv_nested(MPI_COMM_WORLD, vec, result, EXCHANGE_BLOCKING);
+                break;
+            case EXCHANGE_IALLGATHERV:
+                exchange_allgatherv_nested(MPI_COMM_WORLD, vec, result, EXCHANGE_NONBLOCKING);
+                break;
+            case EXCHANGE_NEIGHBOR_ALLGATHERV:
+                exchange_allgatherv_nested(graph, vec, result, EXCHANGE_NEIGHBOR);
+                break;
+            case EXCHANGE_ALLTOALLV:
+                exchange_alltoallv_nested(MPI_COMM_WORLD, vec, result, EXCHANGE_BLOCKING);
+                break;
+            case EXCHANGE_IALLTOALLV:
+                exchange_alltoallv_nested(MPI_COMM_WORLD, vec, result, EXCHANGE_NONBLOCKING);
+                break;
+            case EXCHANGE_NEIGHBOR_ALLTOALLV:
+                exchange_alltoallv_nested(graph, vec, result, EXCHANGE_NEIGHBOR);
+                break;
+            case EXCHANGE_BOOST_ALL_GATHER:
+                gathered.clear();
+                boost::mpi::all_gather(world, vec, gathered);
+                break;
             }
-            MPI_Win_fence(0, win);
         }
 
         // Synchronisation finale
@@ -733,37 +5392,257 @@ static void BM_RDMAMPI_1D(benchmark::State& state) {
         state.SetIterationTime(max_per_op);
     }
 
-    MPI_Win_free(&win);
-    SetBytesProcessed1D(state, array_size, inner_iters);
+    if (graph != MPI_COMM_NULL) {
+        MPI_Comm_free(&graph);
+    }
+    long remote = 0;
+    if (method == EXCHANGE_BOOST_ALL_GATHER) {
+        for (int r = 0; r < static_cast<int>(gathered.size()); r++) {
+            if (r != g_rank) remote += gathered[r].total_elements();
+        }
+    } else {
+        remote = result.remote_elements(g_rank);
+    }
+    long aggregate;
+    MPI_Allreduce(&remote, &aggregate, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+    memory.report(state, inner_iters);
+    state.SetBytesProcessed(state.iterations() * inner_iters * aggregate * sizeof(int));
 }
 
 // ============================================================================
-// Benchmark Boost MPI 1D - Broadcast avec std::vector<int>
+// Échange de halo sur topologie cartésienne (2D ou 3D)
+// Chaque rank envoie à chacun de ses 2 * ndims voisins une liste irrégulière de
+// `outer` vecteurs de bord, emballée dans un buffer contigu (comme le ferait un
+// code stencil), puis reçoit la leur. Le bloc k (voisin peers[k], directions
+// -1/+1 de chaque dimension, ordre de MPI_Cart_shift) reçoit ce que ce voisin
+// a envoyé dans sa direction opposée k ^ 1.
+// Seules les dimensions de plus de 2 ranks sont périodiques : les deux voisins
+// d'une dimension sont ainsi toujours distincts (les collectives de voisinage
+// persistantes d'Open MPI 4.1 intervertissent les deux blocs sinon). Aux bords,
+// le voisin est MPI_PROC_NULL et le halo correspondant est vide.
+// - tailles fixes : les tailles des vecteurs sont échangées une fois au setup
+// - tailles variables : elles changent à chaque pas et sont échangées avant les
+//   données (phase de comptage sur le chemin critique)
 // ============================================================================
-static void BM_BoostMPI_1D(benchmark::State& state) {
-    int array_size = state.range(0);
-    int inner_iters = get_inner_iterations_1d(array_size);
+#define HALO_VARIANTS 4  // formes pré-tirées parcourues pas à pas en mode variable
 
-    boost::mpi::communicator world;
-    std::vector<int> buffer(array_size, g_rank == 0 ? 42 : 0);
+enum HaloMethod {
+    HALO_NEIGHBOR_ALLTOALLV = 0,  // MPI_Neighbor_alltoall(v)
+    HALO_PERSISTENT = 1,          // MPI_Neighbor_alltoall(v)_init + MPI_Start
+    HALO_ISEND_IRECV = 2          // une paire MPI_Isend/MPI_Irecv par voisin
+};
+
+static const char* halo_method_names[] = {"neighbor_alltoallv", "persistent", "isend_irecv"};
+
+// ============================================================================
+// Benchmark Halo MPI
+// Args: {ndims, outer, mean, method, variable}
+// Une opération = un pas de temps. En mode variable, les comptes de données
+// changent à chaque pas : l'alltoallv persistant (comptes figés à l'init) ne
+// s'applique plus qu'aux tailles, les données passent par MPI_Ineighbor_alltoallv.
+// ============================================================================
+static void BM_HaloMPI(benchmark::State& state) {
+    int ndims = state.range(0);
+    int outer_size_param = state.range(1);
+    int mean_size_param = state.range(2);
+    HaloMethod method = static_cast<HaloMethod>(state.range(3));
+    bool variable = state.range(4);
+
+#ifndef BENCH_NEIGHBOR_ALLTOALLV_INIT
+    if (method == HALO_PERSISTENT) {
+        state.SkipWithError("BM_HaloMPI: persistent neighborhood collectives not available");
+        return;
+    }
+#endif
+
+    int dims[3] = {0, 0, 0};
+    int periods[3];
+    MPI_Dims_create(g_size, ndims, dims);
+    for (int d = 0; d < ndims; d++) {
+        periods[d] = dims[d] > 2;
+    }
+    MPI_Comm cart;
+    MPI_Cart_create(MPI_COMM_WORLD, ndims, dims, periods, 0, &cart);
+    int neighbors = 2 * ndims;
+    std::vector<int> peers(neighbors);
+    for (int d = 0; d < ndims; d++) {
+        MPI_Cart_shift(cart, d, 1, &peers[2 * d], &peers[2 * d + 1]);
+    }
+
+    // Forme Zipf mélangée selon la graine : même volume par voisin, mais chaque
+    // variante répartit différemment les tailles entre les vecteurs de bord
+    int variants = variable ? HALO_VARIANTS : 1;
+    std::vector<std::vector<VectorOfVectors>> halos(variants, std::vector<VectorOfVectors>(neighbors));
+    std::vector<std::vector<std::vector<int>>> shapes(variants, std::vector<std::vector<int>>(neighbors));
+    long max_send = 0;
+    int repeated = 0;
+    for (int v = 0; v < variants; v++) {
+        long send = 0;
+        for (int k = 0; k < neighbors; k++) {
+            unsigned seed = 1 + (g_rank * HALO_VARIANTS + v) * neighbors + k;
+            shapes[v][k] = peers[k] == MPI_PROC_NULL
+                ? std::vector<int>(outer_size_param, 0)
+                : make_ragged_shape(outer_size_param, mean_size_param, SHAPE_ZIPF, seed);
+            if (v > 0 && peers[k] != MPI_PROC_NULL && shapes[v][k] == shapes[v - 1][k]) {
+                repeated = 1;
+            }
+            halos[v][k] = VectorOfVectors(shapes[v][k]);
+            send += halos[v][k].total_elements();
+        }
+        max_send = std::max(max_send, send);
+    }
+    // Le mode variable n'a de sens que si les tailles changent d'un pas à l'autre
+    MPI_Allreduce(MPI_IN_PLACE, &repeated, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (repeated) {
+        state.SkipWithError("BM_HaloMPI: consecutive variants have identical sizes");
+        MPI_Comm_free(&cart);
+        return;
+    }
+    long cost = static_cast<long>(neighbors) * (static_cast<long>(outer_size_param) * mean_size_param + RAGGED_MESSAGE_COST);
+    int inner_iters = get_inner_iterations(std::min<long>(cost / 55, std::numeric_limits<int>::max()));
+    MemoryProbe memory;
+
+    std::string shape_label = std::to_string(dims[0]);
+    for (int d = 1; d < ndims; d++) {
+        shape_label += "x" + std::to_string(dims[d]);
+    }
+    state.SetLabel(shape_label + "/" + halo_method_names[method] + (variable ? "/variable" : "/fixed"));
+
+    // Les blocs reçus de MPI_PROC_NULL ne sont jamais écrits : tailles nulles
+    std::vector<int> send_sizes(neighbors * outer_size_param), recv_sizes(neighbors * outer_size_param, 0);
+    std::vector<int> send_counts(neighbors), send_displs(neighbors), recv_counts(neighbors), recv_displs(neighbors);
+    std::vector<int> send_values(max_send), recv_values;
+
+    // Emballe les vecteurs de bord de la variante v, par voisin
+    auto pack = [&](int v) {
+        int offset = 0;
+        for (int k = 0; k < neighbors; k++) {
+            send_displs[k] = offset;
+            for (int j = 0; j < outer_size_param; j++) {
+                const auto& inner = halos[v][k].data[j];
+                send_sizes[k * outer_size_param + j] = inner.size();
+                std::copy(inner.begin(), inner.end(), send_values.begin() + offset);
+                offset += inner.size();
+            }
+            send_counts[k] = offset - send_displs[k];
+        }
+        count_copy(static_cast<long>(offset) * sizeof(int));
+    };
+    // Comptes et décalages de réception d'après les tailles reçues
+    auto plan_receive = [&]() {
+        int offset = 0;
+        for (int k = 0; k < neighbors; k++) {
+            recv_displs[k] = offset;
+            for (int j = 0; j < outer_size_param; j++) {
+                offset += recv_sizes[k * outer_size_param + j];
+            }
+            recv_counts[k] = offset - recv_displs[k];
+        }
+        recv_values.resize(offset);
+    };
+    auto exchange_p2p = [&](int* send, const int* scounts, const int* sdispls, int* recv, const int* rcounts,
+                            const int* rdispls, int tag_base) {
+        RequestWindow window;
+        for (int k = 0; k < neighbors; k++) {
+            MPI_Irecv(recv + rdispls[k], rcounts[k], MPI_INT, peers[k], tag_base + (k ^ 1), cart, window.next());
+        }
+        for (int k = 0; k < neighbors; k++) {
+            MPI_Isend(send + sdispls[k], scounts[k], MPI_INT, peers[k], tag_base + k, cart, window.next());
+        }
+        window.wait_all();
+    };
+    std::vector<int> size_counts(neighbors, outer_size_param), size_displs(neighbors);
+    for (int k = 0; k < neighbors; k++) {
+        size_displs[k] = k * outer_size_param;
+    }
+
+    // Setup hors chronométrage : tailles fixes échangées une fois, requêtes persistantes
+    MPI_Barrier(MPI_COMM_WORLD);
+    double setup_start = MPI_Wtime();
+    MPI_Request sizes_request = MPI_REQUEST_NULL;
+    MPI_Request data_request = MPI_REQUEST_NULL;
+    if (!variable) {
+        pack(0);
+        MPI_Neighbor_alltoall(send_sizes.data(), outer_size_param, MPI_INT, recv_sizes.data(), outer_size_param, MPI_INT, cart);
+        plan_receive();
+    }
+#ifdef BENCH_NEIGHBOR_ALLTOALLV_INIT
+    if (method == HALO_PERSISTENT) {
+        if (variable) {
+            BENCH_NEIGHBOR_ALLTOALL_INIT(send_sizes.data(), outer_size_param, MPI_INT, recv_sizes.data(), outer_size_param,
+                                         MPI_INT, cart, MPI_INFO_NULL, &sizes_request);
+        } else {
+            BENCH_NEIGHBOR_ALLTOALLV_INIT(send_values.data(), send_counts.data(), send_displs.data(), MPI_INT,
+                                          recv_values.data(), recv_counts.data(), recv_displs.data(), MPI_INT, cart,
+                                          MPI_INFO_NULL, &data_request);
+        }
+    }
+#endif
+    double setup_time = MPI_Wtime() - setup_start;
+
+    long step = 0;
+    long sent_elements = 0;
 
+    memory.begin_loop();
     for (auto _ : state) {
         MPI_Barrier(MPI_COMM_WORLD);
         double start = MPI_Wtime();
 
-        for (int iter = 0; iter < inner_iters; iter++) {
-            boost::mpi::broadcast(world, buffer, 0);
+        for (int iter = 0; iter < inner_iters; iter++, step++) {
+            pack(step % variants);
+
+            if (variable) {
+                switch (method) {
+                case HALO_NEIGHBOR_ALLTOALLV:
+                    MPI_Neighbor_alltoall(send_sizes.data(), outer_size_param, MPI_INT, recv_sizes.data(),
+                                          outer_size_param, MPI_INT, cart);
+                    break;
+                case HALO_PERSISTENT:
+                    MPI_Start(&sizes_request);
+                    MPI_Wait(&sizes_request, MPI_STATUS_IGNORE);
+                    break;
+                case HALO_ISEND_IRECV:
+                    exchange_p2p(send_sizes.data(), size_counts.data(), size_displs.data(), recv_sizes.data(),
+                                 size_counts.data(), size_displs.data(), 0);
+                    break;
+                }
+                plan_receive();
+            }
+
+            switch (method) {
+            case HALO_NEIGHBOR_ALLTOALLV:
+                MPI_Neighbor_alltoallv(send_values.data(), send_counts.data(), send_displs.data(), MPI_INT,
+                                       recv_values.data(), recv_counts.data(), recv_displs.data(), MPI_INT, cart);
+                break;
+            case HALO_PERSISTENT:
+                if (variable) {
+                    MPI_Request request;
+                    MPI_Ineighbor_alltoallv(send_values.data(), send_counts.data(), send_displs.data(), MPI_INT,
+                                            recv_values.data(), recv_counts.data(), recv_displs.data(), MPI_INT, cart,
+                                            &request);
+                    MPI_Wait(&request, MPI_STATUS_IGNORE);
+                } else {
+                    MPI_Start(&data_request);
+                    MPI_Wait(&data_request, MPI_STATUS_IGNORE);
+                }
+                break;
+            case HALO_ISEND_IRECV:
+                exchange_p2p(send_values.data(), send_counts.data(), send_displs.data(), recv_values.data(),
+                             recv_counts.data(), recv_displs.data(), neighbors);
+                break;
+            }
+            sent_elements += send_displs[neighbors - 1] + send_counts[neighbors - 1];
         }
 
         // Synchronisation finale
         if (g_rank == 0) {
             int ack;
             for (int dest = 1; dest < g_size; dest++) {
-                world.recv(dest, 1, ack);
+                MPI_Recv(&ack, 1, MPI_INT, dest, 99, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
             }
         } else {
             int ack = 1;
-            world.send(0, 1, ack);
+            MPI_Send(&ack, 1, MPI_INT, 0, 99, MPI_COMM_WORLD);
         }
 
         double elapsed = MPI_Wtime() - start;
@@ -772,7 +5651,22 @@ static void BM_BoostMPI_1D(benchmark::State& state) {
         MPI_Allreduce(&per_op, &max_per_op, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
         state.SetIterationTime(max_per_op);
     }
-    SetBytesProcessed1D(state, array_size, inner_iters);
+
+    if (sizes_request != MPI_REQUEST_NULL) {
+        MPI_Request_free(&sizes_request);
+    }
+    if (data_request != MPI_REQUEST_NULL) {
+        MPI_Request_free(&data_request);
+    }
+    MPI_Comm_free(&cart);
+
+    // Débit agrégé : octets envoyés par tous les ranks
+    long aggregate;
+    MPI_Allreduce(&sent_elements, &aggregate, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+    state.counters["neighbors"] = neighbors;
+    SetSetupCounter(state, setup_time);
+    memory.report(state, inner_iters);
+    state.SetBytesProcessed(aggregate * sizeof(int));
 }
 
 // ============================================================================
@@ -808,13 +5702,152 @@ static void BM_BoostMPI_1D(benchmark::State& state) {
     BENCHMARK(name)->Args({5, 500000})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(2); \
     BENCHMARK(name)->Args({5, 2000000})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(1);
 
+// Mêmes configurations que BENCHMARK_BOOST_CONFIGS avec un troisième argument (variante)
+#define BENCHMARK_BOOST_CONFIGS_ARG(name, arg) \
+    BENCHMARK(name)->Args({5, 50, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 500, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 5000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 50000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3); \
+    BENCHMARK(name)->Args({5, 500000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(2); \
+    BENCHMARK(name)->Args({5, 2000000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(1);
+
+// Mêmes configurations que BENCHMARK_WITH_CONFIGS avec un troisième argument (mode, algorithme...)
+#define BENCHMARK_WITH_CONFIGS_ARG(name, arg) \
+    BENCHMARK(name)->Args({5, 50, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 500, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 5000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 50000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({5, 500000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5); \
+    BENCHMARK(name)->Args({5, 2000000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+
 BENCHMARK_WITH_CONFIGS(BM_RawMPI)
 BENCHMARK_WITH_CONFIGS(BM_BcastMPI)
 BENCHMARK_WITH_CONFIGS(BM_PackMPI)
 BENCHMARK_WITH_CONFIGS(BM_DatatypeMPI)
+BENCHMARK_WITH_CONFIGS(BM_HindexedMPI)
+BENCHMARK_WITH_CONFIGS(BM_HindexedRawMPI)
 BENCHMARK_WITH_CONFIGS(BM_RDMAMPI)
 BENCHMARK_BOOST_CONFIGS(BM_BoostMPI)
 BENCHMARK_BOOST_CONFIGS(BM_BoostPackedMPI)
+BENCHMARK_BOOST_CONFIGS_ARG(BM_BoostArchiveMPI, BOOST_BCAST_FRESH)
+BENCHMARK_BOOST_CONFIGS_ARG(BM_BoostArchiveMPI, BOOST_BCAST_REUSED)
+BENCHMARK_BOOST_CONFIGS_ARG(BM_BoostArchiveMPI, BOOST_ISEND_FRESH)
+BENCHMARK_BOOST_CONFIGS_ARG(BM_BoostArchiveMPI, BOOST_ISEND_REUSED)
+BENCHMARK_WITH_CONFIGS_ARG(BM_BitwiseArchiveMPI, BITWISE_BULK)
+BENCHMARK_WITH_CONFIGS_ARG(BM_BitwiseArchiveMPI, BITWISE_SEGMENTS)
+
+// Stockage de réception réutilisé / allocations chronométrées séparément
+BENCHMARK_WITH_CONFIGS(BM_RawMPI<RECV_POOLED>)
+BENCHMARK_WITH_CONFIGS(BM_RawMPI<RECV_FRESH_TIMED>)
+BENCHMARK_WITH_CONFIGS(BM_BcastMPI<RECV_POOLED>)
+BENCHMARK_WITH_CONFIGS(BM_BcastMPI<RECV_FRESH_TIMED>)
+BENCHMARK_WITH_CONFIGS(BM_PackMPI<RECV_POOLED>)
+BENCHMARK_WITH_CONFIGS(BM_PackMPI<RECV_FRESH_TIMED>)
+BENCHMARK_WITH_CONFIGS(BM_DatatypeMPI<RECV_POOLED>)
+BENCHMARK_WITH_CONFIGS(BM_DatatypeMPI<RECV_FRESH_TIMED>)
+BENCHMARK_BOOST_CONFIGS(BM_BoostMPI<RECV_POOLED>)
+BENCHMARK_WITH_CONFIGS(BM_FlatCSRMPI)
+BENCHMARK_WITH_CONFIGS(BM_FlatCSRRawMPI)
+BENCHMARK_WITH_CONFIGS_ARG(BM_SharedMemMPI, SHM_MAP)
+BENCHMARK_WITH_CONFIGS_ARG(BM_SharedMemMPI, SHM_READ)
+BENCHMARK_WITH_CONFIGS_ARG(BM_SharedMemMPI, SHM_COPY)
+BENCHMARK_WITH_CONFIGS(BM_BoostSkeletonMPI)
+BENCHMARK_WITH_CONFIGS_ARG(BM_BoostSkeletonResendMPI, 1)
+BENCHMARK_WITH_CONFIGS_ARG(BM_BoostSkeletonResendMPI, 10)
+
+// Sweep du nombre de threads (nécessite --mpi_thread_multiple)
+BENCHMARK_WITH_CONFIGS_ARG(BM_ThreadedMPI, 1)
+BENCHMARK_WITH_CONFIGS_ARG(BM_ThreadedMPI, 2)
+BENCHMARK_WITH_CONFIGS_ARG(BM_ThreadedMPI, 4)
+BENCHMARK_WITH_CONFIGS_ARG(BM_ThreadedMPI, 8)
+
+// Histogrammes de latence par opération
+BENCHMARK_WITH_CONFIGS_ARG(BM_LatencyMPI, NESTED_RAW)
+BENCHMARK_WITH_CONFIGS_ARG(BM_LatencyMPI, NESTED_BCAST)
+BENCHMARK_WITH_CONFIGS_ARG(BM_LatencyMPI, NESTED_PACK)
+BENCHMARK_WITH_CONFIGS_ARG(BM_LatencyMPI, NESTED_DATATYPE)
+
+// Broadcasts écrits à la main sur du point-à-point
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_BINOMIAL)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_CHAIN)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_SCATTER_ALLGATHER)
+
+// Dispatcher broadcast_nested() face aux stratégies fixes (même harnais)
+BENCHMARK_WITH_CONFIGS(BM_TunedNestedMPI)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_RAW)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_BCAST)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_PACK)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_DATATYPE)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_RDMA)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_BOOST)
+BENCHMARK_WITH_CONFIGS_ARG(BM_NestedMPI, NESTED_BOOST_PACKED)
+
+// Stratégies génériques sur le type d'élément, jusqu'à XLarge (~55 Mo d'éléments de 64 octets)
+#define BENCHMARK_TYPED_CONFIGS_ARG(name, type, arg) \
+    BENCHMARK_TEMPLATE(name, type)->Args({5, 50, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK_TEMPLATE(name, type)->Args({5, 500, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK_TEMPLATE(name, type)->Args({5, 5000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK_TEMPLATE(name, type)->Args({5, 50000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+
+#define BENCHMARK_TYPED_STRATEGIES(type) \
+    BENCHMARK_TYPED_CONFIGS_ARG(BM_TypedNestedMPI, type, NESTED_RAW) \
+    BENCHMARK_TYPED_CONFIGS_ARG(BM_TypedNestedMPI, type, NESTED_BCAST) \
+    BENCHMARK_TYPED_CONFIGS_ARG(BM_TypedNestedMPI, type, NESTED_PACK) \
+    BENCHMARK_TYPED_CONFIGS_ARG(BM_TypedNestedMPI, type, NESTED_DATATYPE) \
+    BENCHMARK_TEMPLATE(BM_TypedBoostMPI, type)->Args({5, 50})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK_TEMPLATE(BM_TypedBoostMPI, type)->Args({5, 500})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK_TEMPLATE(BM_TypedBoostMPI, type)->Args({5, 5000})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK_TEMPLATE(BM_TypedBoostMPI, type)->Args({5, 50000})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+
+BENCHMARK_TYPED_STRATEGIES(int)
+BENCHMARK_TYPED_STRATEGIES(double)
+BENCHMARK_TYPED_STRATEGIES(Pod16)
+BENCHMARK_TYPED_STRATEGIES(Pod64)
+
+// Formes irrégulières : 10^4 / 10^5 vecteurs (moyenne 16 ou 256) et 10^6 vecteurs (moyenne 16)
+BENCHMARK(BM_RaggedMPI)->ArgsProduct({{10000}, {16, 256}, {SHAPE_UNIFORM, SHAPE_QUADRATIC, SHAPE_ZIPF, SHAPE_MANY_EMPTY},
+                                      benchmark::CreateDenseRange(0, NESTED_STRATEGY_COUNT - 1, 1)})
+    ->ArgNames({"outer", "mean", "shape", "strategy"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_RaggedMPI)->ArgsProduct({{100000}, {16, 256}, {SHAPE_UNIFORM, SHAPE_QUADRATIC, SHAPE_ZIPF, SHAPE_MANY_EMPTY},
+                                      benchmark::CreateDenseRange(0, NESTED_STRATEGY_COUNT - 1, 1)})
+    ->ArgNames({"outer", "mean", "shape", "strategy"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_RaggedMPI)->ArgsProduct({{1000000}, {16}, {SHAPE_UNIFORM, SHAPE_QUADRATIC, SHAPE_ZIPF, SHAPE_MANY_EMPTY},
+                                      benchmark::CreateDenseRange(0, NESTED_STRATEGY_COUNT - 1, 1)})
+    ->ArgNames({"outer", "mean", "shape", "strategy"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+
+// Hybride : seuil de 0 (tout en messages séparés) à 2^30 (tout dans l'agrégat)
+BENCHMARK(BM_HybridMPI)->ArgsProduct({{10000, 100000}, {64}, {SHAPE_UNIFORM, SHAPE_ZIPF, SHAPE_MANY_EMPTY},
+                                      {0, 64, 1024, 16384, 1 << 30}, {HYBRID_BCAST}})
+    ->ArgNames({"outer", "mean", "shape", "threshold", "transport"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_HybridMPI)->ArgsProduct({{10000, 100000}, {64}, {SHAPE_UNIFORM, SHAPE_ZIPF, SHAPE_MANY_EMPTY},
+                                      {0, 64, 1024, 16384, 1 << 30}, {HYBRID_P2P}})
+    ->ArgNames({"outer", "mean", "shape", "threshold", "transport"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+
+// Échange tous-vers-tous : chaque rank contribue ~outer * mean éléments
+BENCHMARK(BM_ExchangeMPI)->ArgsProduct({{10000}, {16, 256}, {SHAPE_UNIFORM, SHAPE_QUADRATIC, SHAPE_ZIPF, SHAPE_MANY_EMPTY},
+                                        {EXCHANGE_ALLGATHERV, EXCHANGE_IALLGATHERV, EXCHANGE_NEIGHBOR_ALLGATHERV, EXCHANGE_ALLTOALLV,
+                                         EXCHANGE_IALLTOALLV, EXCHANGE_NEIGHBOR_ALLTOALLV, EXCHANGE_BOOST_ALL_GATHER}})
+    ->ArgNames({"outer", "mean", "shape", "method"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10);
+BENCHMARK(BM_ExchangeMPI)->ArgsProduct({{100000}, {16}, {SHAPE_UNIFORM, SHAPE_ZIPF},
+                                        {EXCHANGE_ALLGATHERV, EXCHANGE_IALLGATHERV, EXCHANGE_NEIGHBOR_ALLGATHERV, EXCHANGE_ALLTOALLV,
+                                         EXCHANGE_IALLTOALLV, EXCHANGE_NEIGHBOR_ALLTOALLV, EXCHANGE_BOOST_ALL_GATHER}})
+    ->ArgNames({"outer", "mean", "shape", "method"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+
+// Halo : 2D/3D x {neighbor_alltoallv, persistent, isend_irecv} x {tailles fixes, variables}
+BENCHMARK(BM_HaloMPI)->ArgsProduct({{2, 3}, {64, 1024}, {4, 64}, {HALO_NEIGHBOR_ALLTOALLV, HALO_PERSISTENT, HALO_ISEND_IRECV}, {0, 1}})
+    ->ArgNames({"ndims", "outer", "mean", "method", "variable"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10);
+
+// Compression : Large/XLarge/XXLarge x {zero, random, smooth, sparse, monotonic} x {none, delta_bitpack, lz}
+BENCHMARK(BM_CompressedMPI)->ArgsProduct({{5}, {5000, 50000}, {CONTENT_ZERO, CONTENT_RANDOM, CONTENT_SMOOTH, CONTENT_SPARSE, CONTENT_MONOTONIC}, {CODEC_NONE, CODEC_DELTA_BITPACK, CODEC_LZ}})
+    ->ArgNames({"outer", "base", "content", "codec"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10);
+BENCHMARK(BM_CompressedMPI)->ArgsProduct({{5}, {500000}, {CONTENT_ZERO, CONTENT_RANDOM, CONTENT_SMOOTH, CONTENT_SPARSE, CONTENT_MONOTONIC}, {CODEC_NONE, CODEC_DELTA_BITPACK, CODEC_LZ}})
+    ->ArgNames({"outer", "base", "content", "codec"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+
+// Recouvrement : Large/XLarge/XXLarge x {stream, fma} x {none, test, thread}, calcul = 100 % de la communication
+BENCHMARK(BM_OverlapMPI)->ArgsProduct({{5}, {5000, 50000}, {KERNEL_STREAM, KERNEL_FMA}, {PROGRESS_NONE, PROGRESS_TEST, PROGRESS_THREAD}, {100}})
+    ->ArgNames({"outer", "base", "kernel", "progress", "compute_pct"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10);
+BENCHMARK(BM_OverlapMPI)->ArgsProduct({{5}, {500000}, {KERNEL_STREAM, KERNEL_FMA}, {PROGRESS_NONE, PROGRESS_TEST, PROGRESS_THREAD}, {100}})
+    ->ArgNames({"outer", "base", "kernel", "progress", "compute_pct"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
 
 // ============================================================================
 // Configuration 1D - Tailles équivalentes aux benchmarks 2D
@@ -831,21 +5864,116 @@ BENCHMARK_BOOST_CONFIGS(BM_BoostPackedMPI)
     BENCHMARK(name)->Args({27500000})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5); \
     BENCHMARK(name)->Args({110000000})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
 
+#define BENCHMARK_1D_CONFIGS_ARG(name, arg) \
+    BENCHMARK(name)->Args({2750, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({27500, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({275000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({2750000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(10); \
+    BENCHMARK(name)->Args({27500000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5); \
+    BENCHMARK(name)->Args({110000000, arg})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+
 BENCHMARK_1D_CONFIGS(BM_RawMPI_1D)
 BENCHMARK_1D_CONFIGS(BM_BcastMPI_1D)
 BENCHMARK_1D_CONFIGS(BM_RDMAMPI_1D)
 BENCHMARK_1D_CONFIGS(BM_BoostMPI_1D)
 
+// Comptes 64 bits : 2 Go / 8 Go / 16 Go par rank, ignorés si la mémoire du nœud ne suffit pas
+#define BENCHMARK_LARGE_1D_CONFIGS(name) \
+    BENCHMARK(name)->Args({536870912})->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3); \
+    BENCHMARK(name)->Args({2147483648})->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(2); \
+    BENCHMARK(name)->Args({4294967296})->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK_LARGE_1D_CONFIGS(BM_LargeBcastMPI_1D)
+BENCHMARK_LARGE_1D_CONFIGS(BM_LargeRawMPI_1D)
+BENCHMARK(BM_LargeBcastMPI)->Args({5, 9761289})->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK(BM_LargeBcastMPI)->Args({5, 39045157})->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(2);
+BENCHMARK(BM_LargeBcastMPI)->Args({5, 78090314})->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(1);
+
+// RMA passive-target, chunks de 1 MiB
+BENCHMARK_WITH_CONFIGS_ARG(BM_PassiveRMAMPI, 1024)
+BENCHMARK_1D_CONFIGS_ARG(BM_PassiveRMAMPI_1D, 1024)
+
+// Variantes persistantes (setup reporté séparément dans "setup_us")
+BENCHMARK_WITH_CONFIGS(BM_PersistentRawMPI)
+BENCHMARK_1D_CONFIGS(BM_PersistentRawMPI_1D)
+#ifdef BENCH_BCAST_INIT
+BENCHMARK_WITH_CONFIGS(BM_PersistentBcastMPI)
+BENCHMARK_1D_CONFIGS(BM_PersistentBcastMPI_1D)
+#endif
+
+// ============================================================================
+// Sweep du broadcast pipeliné sur XXLarge/XXXLarge
+// segment_kib: 64 KiB .. 4 MiB, depth: 1 .. 8 segments en vol
+// ============================================================================
+
+BENCHMARK(BM_PipelinedBcastMPI)->ArgsProduct({{5}, {500000}, {64, 256, 1024, 4096}, {1, 2, 4, 8}})
+    ->ArgNames({"outer", "base", "seg_kib", "depth"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_PipelinedBcastMPI)->ArgsProduct({{5}, {2000000}, {64, 256, 1024, 4096}, {1, 2, 4, 8}})
+    ->ArgNames({"outer", "base", "seg_kib", "depth"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+BENCHMARK(BM_PipelinedBcastMPI_1D)->ArgsProduct({{27500000}, {64, 256, 1024, 4096}, {1, 2, 4, 8}})
+    ->ArgNames({"size", "seg_kib", "depth"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(5);
+BENCHMARK(BM_PipelinedBcastMPI_1D)->ArgsProduct({{110000000}, {64, 256, 1024, 4096}, {1, 2, 4, 8}})
+    ->ArgNames({"size", "seg_kib", "depth"})->UseManualTime()->Unit(benchmark::kMicrosecond)->Iterations(3);
+
 // ============================================================================
 // Main
 // ============================================================================
 int main(int argc, char** argv) {
-    int provided;
-    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+    // --mpi_thread_multiple : initialise MPI en MPI_THREAD_MULTIPLE (requis par BM_ThreadedMPI)
+    // --nested_tuning=<fichier> : table de broadcast_nested() ; calibrée puis écrite si absente
+    // --nested_calibrate : force la calibration au démarrage (réécrit le fichier s'il est donné)
+    // --memory_counters : compteurs mémoire (pic RSS, allocations, copies, TLB, fautes de page) sur les benchmarks instrumentés
+    // --alloc_mode=<default|mpi|thp|hugetlb|numa> : allocation des buffers de données
+    int required = MPI_THREAD_FUNNELED;
+    std::string tuning_path;
+    bool calibrate = false;
+    std::string alloc_mode_name = "default";
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--mpi_thread_multiple") == 0) {
+            required = MPI_THREAD_MULTIPLE;
+        } else if (std::strncmp(argv[i], "--nested_tuning=", 16) == 0) {
+            tuning_path = argv[i] + 16;
+        } else if (std::strcmp(argv[i], "--nested_calibrate") == 0) {
+            calibrate = true;
+        } else if (std::strcmp(argv[i], "--memory_counters") == 0) {
+            g_memory_counters = true;
+        } else if (std::strncmp(argv[i], "--alloc_mode=", 13) == 0) {
+            alloc_mode_name = argv[i] + 13;
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+
+    MPI_Init_thread(&argc, &argv, required, &g_thread_level);
     MPI_Comm_rank(MPI_COMM_WORLD, &g_rank);
     MPI_Comm_size(MPI_COMM_WORLD, &g_size);
+    nested_copy_hook = count_copy;  // copies des stratégies nested_* dans copied_bytes
+
+    if (!select_alloc_mode(alloc_mode_name)) {
+        if (g_rank == 0) {
+            std::cerr << "Unknown --alloc_mode=" << alloc_mode_name << std::endl;
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (!tuning_path.empty() && !calibrate) {
+        g_nested_tuning_measured = g_nested_tuning.load(tuning_path, MPI_COMM_WORLD);
+        calibrate = !g_nested_tuning_measured;
+    }
+    if (calibrate) {
+        g_nested_tuning = calibrate_nested_tuning<BufferVector<int>>(MPI_COMM_WORLD);
+        g_nested_tuning_measured = true;
+        if (g_rank == 0 && !tuning_path.empty() && !g_nested_tuning.save(tuning_path)) {
+            std::cerr << "Cannot write tuning file " << tuning_path << std::endl;
+        }
+    }
 
+    RegisterScalingBenchmarks();
     benchmark::Initialize(&argc, argv);
+    benchmark::AddCustomContext("alloc_mode", alloc_mode_names[g_alloc_mode]);
 
     if (g_rank == 0) {
         benchmark::RunSpecifiedBenchmarks();
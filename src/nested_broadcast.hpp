@@ -0,0 +1,832 @@
+// ============================================================================
+// nested_broadcast.hpp - distribution d'un vecteur de vecteurs depuis un root
+// Bibliothèque header-only (cible CMake `nested_broadcast`) : les stratégies
+// nested_*, le dispatcher broadcast_nested() et sa table de réglage. Elles opèrent
+// sur std::vector<Inner>, où Inner est un conteneur contigu (std::vector<T, Alloc>)
+// dont l'élément T a un datatype MPI (mpi_type_traits) et, pour les stratégies
+// Boost, une fonction serialize.
+// ============================================================================
+#ifndef NESTED_BROADCAST_HPP
+#define NESTED_BROADCAST_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <mpi.h>
+#include <boost/mpi.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+
+// ============================================================================
+// Correspondance type C++ -> MPI_Datatype, résolue à la compilation
+// - types de base : datatype MPI prédéfini
+// - structs POD exposant `static void mpi_fields(MpiFields&)` : MPI_Type_create_struct
+//   redimensionné à sizeof(T) (le padding n'est pas transféré)
+// - autres types trivialement copiables : sizeof(T) octets contigus
+// Les types dérivés sont créés au premier appel et jamais libérés (durée du programme).
+// ============================================================================
+struct MpiFields {
+    std::vector<int> blocklens;
+    std::vector<MPI_Aint> displs;
+    std::vector<MPI_Datatype> types;
+
+    void add(int count, MPI_Aint displ, MPI_Datatype type) {
+        blocklens.push_back(count);
+        displs.push_back(displ);
+        types.push_back(type);
+    }
+};
+
+template <typename T, typename = void>
+struct has_mpi_fields : std::false_type {};
+
+template <typename T>
+struct has_mpi_fields<T, std::void_t<decltype(T::mpi_fields(std::declval<MpiFields&>()))>> : std::true_type {};
+
+template <typename T, typename = void>
+struct mpi_type_traits {
+    static_assert(std::is_trivially_copyable<T>::value, "element type must be trivially copyable");
+    static constexpr bool is_struct = has_mpi_fields<T>::value;
+
+    static MPI_Datatype get() {
+        static MPI_Datatype type = create();
+        return type;
+    }
+
+private:
+    static MPI_Datatype create() {
+        MPI_Datatype type;
+        if constexpr (is_struct) {
+            MpiFields fields;
+            T::mpi_fields(fields);
+            MPI_Datatype packed;
+            MPI_Type_create_struct(fields.blocklens.size(), fields.blocklens.data(), fields.displs.data(),
+                                   fields.types.data(), &packed);
+            MPI_Type_create_resized(packed, 0, sizeof(T), &type);
+            MPI_Type_free(&packed);
+        } else {
+            MPI_Type_contiguous(sizeof(T), MPI_BYTE, &type);
+        }
+        MPI_Type_commit(&type);
+        return type;
+    }
+};
+
+#define MPI_TYPE_TRAIT(cpp_type, mpi_type) \
+    template <> struct mpi_type_traits<cpp_type> { \
+        static constexpr bool is_struct = false; \
+        static MPI_Datatype get() { return mpi_type; } \
+    };
+
+MPI_TYPE_TRAIT(char, MPI_CHAR)
+MPI_TYPE_TRAIT(int, MPI_INT)
+MPI_TYPE_TRAIT(long, MPI_LONG)
+MPI_TYPE_TRAIT(float, MPI_FLOAT)
+MPI_TYPE_TRAIT(double, MPI_DOUBLE)
+
+template <typename T>
+inline MPI_Datatype mpi_datatype() {
+    return mpi_type_traits<T>::get();
+}
+
+// ============================================================================
+// Messages par vecteur interne avec un grand outer_size
+// - Un seul tag de données (TAG_DATA) : les messages d'une même paire
+//   (source, tag, communicateur) ne se doublent pas, l'ordre j suffit donc à
+//   apparier les vecteurs sans dépasser MPI_TAG_UB.
+// - Au plus MAX_INFLIGHT_REQUESTS requêtes en vol ; au-delà, la fenêtre est
+//   vidée par MPI_Waitall avant de poster la suivante.
+// Espace de tags point à point des stratégies : 0 (outer_size) et 1 (tailles
+// internes) pour les en-têtes, puis un tag par phase de données ; un appelant
+// qui partage le communicateur doit éviter les tags 0 à TAG_RING.
+// ============================================================================
+#define TAG_DATA 2
+#define TAG_SCATTER 3  // scatter des blocs de nested_scatter_allgather
+#define TAG_RING 4     // allgather en anneau de nested_scatter_allgather
+#define MAX_INFLIGHT_REQUESTS 1024
+
+class RequestWindow {
+public:
+    RequestWindow() { requests_.reserve(MAX_INFLIGHT_REQUESTS); }
+
+    MPI_Request* next() {
+        if (requests_.size() == MAX_INFLIGHT_REQUESTS) {
+            wait_all();
+        }
+        requests_.emplace_back();
+        return &requests_.back();
+    }
+
+    void wait_all() {
+        MPI_Waitall(requests_.size(), requests_.data(), MPI_STATUSES_IGNORE);
+        requests_.clear();
+    }
+
+private:
+    std::vector<MPI_Request> requests_;
+};
+
+// Crochet d'instrumentation : reçoit le nombre d'octets recopiés en plus du
+// transfert lui-même (pack, aplatissement, sérialisation). Aucun par défaut.
+inline void (*nested_copy_hook)(long bytes) = nullptr;
+
+inline void nested_count_copy(long bytes) {
+    if (nested_copy_hook) nested_copy_hook(bytes);
+}
+
+// Taille totale en nombre d'éléments (peut dépasser 2^31)
+template <typename Inner>
+long nested_total_elements(const std::vector<Inner>& vec) {
+    long total = 0;
+    for (const auto& inner : vec) {
+        total += inner.size();
+    }
+    return total;
+}
+
+// ============================================================================
+// Stratégies - une opération de distribution d'un std::vector<Inner>
+// Le root envoie `vec`, les autres ranks reçoivent dans `vec` (redimensionné).
+// Mêmes protocoles que BM_RawMPI, BM_BcastMPI, BM_PackMPI, BM_DatatypeMPI,
+// BM_RDMAMPI, BM_BoostMPI et BM_BoostPackedMPI.
+// ============================================================================
+enum NestedStrategy {
+    NESTED_RAW = 0,
+    NESTED_BCAST = 1,
+    NESTED_PACK = 2,
+    NESTED_DATATYPE = 3,
+    NESTED_BINOMIAL = 4,
+    NESTED_CHAIN = 5,
+    NESTED_SCATTER_ALLGATHER = 6,
+    NESTED_RDMA = 7,
+    NESTED_BOOST = 8,
+    NESTED_BOOST_PACKED = 9,
+    NESTED_STRATEGY_COUNT
+};
+
+inline const char* const nested_strategy_names[NESTED_STRATEGY_COUNT] = {
+    "raw", "bcast", "pack", "datatype", "binomial", "chain", "scatter_allgather", "rdma", "boost", "boost_packed"};
+
+template <typename Inner>
+void nested_raw(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    if (rank == root) {
+        int outer_size = vec.size();
+        std::vector<int> inner_sizes(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            inner_sizes[j] = vec[j].size();
+        }
+        RequestWindow window;
+        for (int dest = 0; dest < size; dest++) {
+            if (dest == root) continue;
+            MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, comm, window.next());
+            MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, comm, window.next());
+            for (int j = 0; j < outer_size; j++) {
+                MPI_Isend(vec[j].data(), inner_sizes[j], mpi_datatype<T>(), dest, TAG_DATA, comm, window.next());
+            }
+        }
+        window.wait_all();
+    } else {
+        int recv_outer_size;
+        MPI_Recv(&recv_outer_size, 1, MPI_INT, root, 0, comm, MPI_STATUS_IGNORE);
+        std::vector<int> recv_inner_sizes(recv_outer_size);
+        MPI_Recv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, root, 1, comm, MPI_STATUS_IGNORE);
+
+        vec.resize(recv_outer_size);
+        RequestWindow window;
+        for (int j = 0; j < recv_outer_size; j++) {
+            vec[j].resize(recv_inner_sizes[j]);
+            MPI_Irecv(vec[j].data(), recv_inner_sizes[j], mpi_datatype<T>(), root, TAG_DATA, comm, window.next());
+        }
+        window.wait_all();
+    }
+}
+
+template <typename Inner>
+void nested_bcast(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    int outer_size = vec.size();
+    MPI_Bcast(&outer_size, 1, MPI_INT, root, comm);
+    std::vector<int> inner_sizes(outer_size);
+    if (rank == root) {
+        for (int j = 0; j < outer_size; j++) {
+            inner_sizes[j] = vec[j].size();
+        }
+    }
+    MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, root, comm);
+
+    if (rank != root) {
+        vec.resize(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            vec[j].resize(inner_sizes[j]);
+        }
+    }
+    RequestWindow window;
+    for (int j = 0; j < outer_size; j++) {
+        MPI_Ibcast(vec[j].data(), inner_sizes[j], mpi_datatype<T>(), root, comm, window.next());
+    }
+    window.wait_all();
+}
+
+template <typename Inner>
+void nested_pack(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    if (rank == root) {
+        int outer_size = vec.size();
+        std::vector<int> inner_sizes(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            inner_sizes[j] = vec[j].size();
+        }
+        // Les positions de MPI_Pack sont des int : au-delà de INT_MAX octets packés,
+        // la taille annoncée vaut -1 et tous les ranks repassent par nested_bcast
+        int int_pack_size, sizes_pack_size;
+        MPI_Pack_size(1, MPI_INT, comm, &int_pack_size);
+        MPI_Pack_size(outer_size, MPI_INT, comm, &sizes_pack_size);
+        long packed_bytes = int_pack_size + sizes_pack_size;
+        for (int j = 0; j < outer_size; j++) {
+            int data_pack_size;
+            MPI_Pack_size(inner_sizes[j], mpi_datatype<T>(), comm, &data_pack_size);
+            packed_bytes += data_pack_size;
+        }
+        if (packed_bytes > std::numeric_limits<int>::max()) {
+            int overflow = -1;
+            MPI_Bcast(&overflow, 1, MPI_INT, root, comm);
+            nested_bcast(comm, vec, root);
+            return;
+        }
+        int total_size = packed_bytes;
+        std::vector<char> buffer(total_size);
+
+        int position = 0;
+        MPI_Pack(&outer_size, 1, MPI_INT, buffer.data(), total_size, &position, comm);
+        MPI_Pack(inner_sizes.data(), outer_size, MPI_INT, buffer.data(), total_size, &position, comm);
+        for (int j = 0; j < outer_size; j++) {
+            MPI_Pack(vec[j].data(), inner_sizes[j], mpi_datatype<T>(), buffer.data(), total_size, &position, comm);
+        }
+        nested_count_copy(position);
+        MPI_Bcast(&position, 1, MPI_INT, root, comm);
+        MPI_Bcast(buffer.data(), position, MPI_PACKED, root, comm);
+    } else {
+        int packed_size;
+        MPI_Bcast(&packed_size, 1, MPI_INT, root, comm);
+        if (packed_size < 0) {
+            nested_bcast(comm, vec, root);
+            return;
+        }
+        std::vector<char> recv_buffer(packed_size);
+        MPI_Bcast(recv_buffer.data(), packed_size, MPI_PACKED, root, comm);
+
+        int position = 0;
+        int recv_outer_size;
+        MPI_Unpack(recv_buffer.data(), packed_size, &position, &recv_outer_size, 1, MPI_INT, comm);
+        std::vector<int> recv_inner_sizes(recv_outer_size);
+        MPI_Unpack(recv_buffer.data(), packed_size, &position, recv_inner_sizes.data(), recv_outer_size, MPI_INT, comm);
+
+        vec.resize(recv_outer_size);
+        for (int j = 0; j < recv_outer_size; j++) {
+            vec[j].resize(recv_inner_sizes[j]);
+            MPI_Unpack(recv_buffer.data(), packed_size, &position, vec[j].data(), recv_inner_sizes[j], mpi_datatype<T>(), comm);
+        }
+        nested_count_copy(packed_size);
+    }
+}
+
+template <typename Inner>
+void nested_datatype(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    if (rank == root) {
+        int outer_size = vec.size();
+        std::vector<int> inner_sizes(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            inner_sizes[j] = vec[j].size();
+        }
+        RequestWindow window;
+        for (int dest = 0; dest < size; dest++) {
+            if (dest == root) continue;
+            MPI_Isend(&outer_size, 1, MPI_INT, dest, 0, comm, window.next());
+            MPI_Isend(inner_sizes.data(), outer_size, MPI_INT, dest, 1, comm, window.next());
+        }
+        for (int j = 0; j < outer_size; j++) {
+            MPI_Datatype inner_type;
+            MPI_Type_contiguous(inner_sizes[j], mpi_datatype<T>(), &inner_type);
+            MPI_Type_commit(&inner_type);
+            for (int dest = 0; dest < size; dest++) {
+                if (dest == root) continue;
+                MPI_Isend(vec[j].data(), 1, inner_type, dest, TAG_DATA, comm, window.next());
+            }
+            MPI_Type_free(&inner_type);
+        }
+        window.wait_all();
+    } else {
+        int recv_outer_size;
+        MPI_Recv(&recv_outer_size, 1, MPI_INT, root, 0, comm, MPI_STATUS_IGNORE);
+        std::vector<int> recv_inner_sizes(recv_outer_size);
+        MPI_Recv(recv_inner_sizes.data(), recv_outer_size, MPI_INT, root, 1, comm, MPI_STATUS_IGNORE);
+
+        vec.resize(recv_outer_size);
+        for (int j = 0; j < recv_outer_size; j++) {
+            MPI_Datatype inner_type;
+            MPI_Type_contiguous(recv_inner_sizes[j], mpi_datatype<T>(), &inner_type);
+            MPI_Type_commit(&inner_type);
+            vec[j].resize(recv_inner_sizes[j]);
+            MPI_Recv(vec[j].data(), 1, inner_type, root, TAG_DATA, comm, MPI_STATUS_IGNORE);
+            MPI_Type_free(&inner_type);
+        }
+    }
+}
+
+// ============================================================================
+// Algorithmes de broadcast écrits à la main sur du point-à-point
+// Rangs relatifs au root : vr = (rank - root + size) % size
+// ============================================================================
+#define CHAIN_SEGMENT_BYTES (1024 * 1024)
+
+// Diffuse l'en-tête (outer_size puis tailles internes) le long d'un arbre binomial
+// et redimensionne `vec` sur les receveurs
+template <typename Inner>
+void tree_bcast_shape(MPI_Comm comm, std::vector<Inner>& vec, std::vector<int>& inner_sizes, int root) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int vr = (rank - root + size) % size;
+
+    int outer_size = vec.size();
+    if (vr == 0) {
+        inner_sizes.resize(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            inner_sizes[j] = vec[j].size();
+        }
+    }
+
+    int mask = 1;
+    while (mask < size) {
+        if (vr & mask) {
+            int src = (vr - mask + root) % size;
+            MPI_Recv(&outer_size, 1, MPI_INT, src, 0, comm, MPI_STATUS_IGNORE);
+            inner_sizes.resize(outer_size);
+            MPI_Recv(inner_sizes.data(), outer_size, MPI_INT, src, 1, comm, MPI_STATUS_IGNORE);
+            break;
+        }
+        mask <<= 1;
+    }
+    mask >>= 1;
+    while (mask > 0) {
+        if (vr + mask < size) {
+            int dst = (vr + mask + root) % size;
+            MPI_Send(&outer_size, 1, MPI_INT, dst, 0, comm);
+            MPI_Send(inner_sizes.data(), outer_size, MPI_INT, dst, 1, comm);
+        }
+        mask >>= 1;
+    }
+
+    if (vr != 0) {
+        vec.resize(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            vec[j].resize(inner_sizes[j]);
+        }
+    }
+}
+
+// Arbre binomial : chaque rank reçoit tous les vecteurs de son parent puis les relaie
+template <typename Inner>
+void nested_binomial(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int vr = (rank - root + size) % size;
+
+    std::vector<int> inner_sizes;
+    tree_bcast_shape(comm, vec, inner_sizes, root);
+    int outer_size = inner_sizes.size();
+
+    int mask = 1;
+    while (mask < size) {
+        if (vr & mask) {
+            int src = (vr - mask + root) % size;
+            RequestWindow window;
+            for (int j = 0; j < outer_size; j++) {
+                MPI_Irecv(vec[j].data(), inner_sizes[j], mpi_datatype<T>(), src, TAG_DATA, comm, window.next());
+            }
+            window.wait_all();
+            break;
+        }
+        mask <<= 1;
+    }
+    mask >>= 1;
+    RequestWindow window;
+    while (mask > 0) {
+        if (vr + mask < size) {
+            int dst = (vr + mask + root) % size;
+            for (int j = 0; j < outer_size; j++) {
+                MPI_Isend(vec[j].data(), inner_sizes[j], mpi_datatype<T>(), dst, TAG_DATA, comm, window.next());
+            }
+        }
+        mask >>= 1;
+    }
+    window.wait_all();
+}
+
+// Chaîne pipelinée : chaque vecteur est découpé en segments de CHAIN_SEGMENT_BYTES octets,
+// un segment reçu du prédécesseur est immédiatement relayé au successeur
+template <typename Inner>
+void nested_chain(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int vr = (rank - root + size) % size;
+    int prev = (vr - 1 + root + size) % size;
+    int next = (vr + 1 + root) % size;
+    bool has_next = vr + 1 < size;
+
+    std::vector<int> inner_sizes;
+    tree_bcast_shape(comm, vec, inner_sizes, root);
+    int outer_size = inner_sizes.size();
+
+    const int segment_elems = std::max<int>(1, CHAIN_SEGMENT_BYTES / sizeof(T));
+    RequestWindow window;
+    for (int j = 0; j < outer_size; j++) {
+        for (int offset = 0; offset < inner_sizes[j]; offset += segment_elems) {
+            int seg = std::min(segment_elems, inner_sizes[j] - offset);
+            T* ptr = vec[j].data() + offset;
+            if (vr != 0) {
+                MPI_Recv(ptr, seg, mpi_datatype<T>(), prev, TAG_DATA, comm, MPI_STATUS_IGNORE);
+            }
+            if (has_next) {
+                MPI_Isend(ptr, seg, mpi_datatype<T>(), next, TAG_DATA, comm, window.next());
+            }
+        }
+    }
+    window.wait_all();
+}
+
+// Type hindexed décrivant la plage [begin, end) de la concaténation des vecteurs internes
+template <typename Inner>
+MPI_Datatype flat_range_type(std::vector<Inner>& vec, long begin, long end) {
+    using T = typename Inner::value_type;
+    std::vector<int> blocklens;
+    std::vector<MPI_Aint> displs;
+    long offset = 0;
+    for (auto& inner : vec) {
+        long inner_end = offset + inner.size();
+        long lo = std::max(begin, offset);
+        long hi = std::min(end, inner_end);
+        if (lo < hi) {
+            MPI_Aint addr;
+            MPI_Get_address(inner.data() + (lo - offset), &addr);
+            displs.push_back(addr);
+            blocklens.push_back(hi - lo);
+        }
+        offset = inner_end;
+    }
+    MPI_Datatype type;
+    MPI_Type_create_hindexed(blocklens.size(), blocklens.data(), displs.data(), mpi_datatype<T>(), &type);
+    MPI_Type_commit(&type);
+    return type;
+}
+
+// van de Geijn : scatter de P blocs de la concaténation, puis allgather en anneau (P - 1 étapes)
+template <typename Inner>
+void nested_scatter_allgather(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int vr = (rank - root + size) % size;
+
+    std::vector<int> inner_sizes;
+    tree_bcast_shape(comm, vec, inner_sizes, root);
+    long total = 0;
+    for (int n : inner_sizes) total += n;
+
+    // Bloc b (indexé en rang relatif) = [b * total / P, (b + 1) * total / P)
+    std::vector<MPI_Datatype> blocks(size);
+    for (int b = 0; b < size; b++) {
+        blocks[b] = flat_range_type(vec, b * total / size, (b + 1) * total / size);
+    }
+
+    if (vr == 0) {
+        std::vector<MPI_Request> requests;
+        for (int b = 1; b < size; b++) {
+            MPI_Request req;
+            MPI_Isend(MPI_BOTTOM, 1, blocks[b], (b + root) % size, TAG_SCATTER, comm, &req);
+            requests.push_back(req);
+        }
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    } else {
+        MPI_Recv(MPI_BOTTOM, 1, blocks[vr], root, TAG_SCATTER, comm, MPI_STATUS_IGNORE);
+    }
+
+    int left = (rank - 1 + size) % size;
+    int right = (rank + 1) % size;
+    for (int step = 0; step < size - 1; step++) {
+        int send_block = (vr - step + size) % size;
+        int recv_block = (vr - step - 1 + size) % size;
+        MPI_Sendrecv(MPI_BOTTOM, 1, blocks[send_block], right, TAG_RING,
+                     MPI_BOTTOM, 1, blocks[recv_block], left, TAG_RING, comm, MPI_STATUS_IGNORE);
+    }
+
+    for (auto& type : blocks) {
+        MPI_Type_free(&type);
+    }
+}
+
+// One-sided : le root aplatit `vec` dans une fenêtre créée pour l'appel, chaque
+// receveur lit ses vecteurs internes directement à leur place (un MPI_Get par vecteur).
+// La création et la libération de la fenêtre (collectives) font partie de l'opération.
+template <typename Inner>
+void nested_rdma(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    if (size == 1) return;  // rien à transférer (et Open MPI 4.1 refuse la fenêtre)
+
+    int outer_size = vec.size();
+    MPI_Bcast(&outer_size, 1, MPI_INT, root, comm);
+    std::vector<int> inner_sizes(outer_size);
+    if (rank == root) {
+        for (int j = 0; j < outer_size; j++) {
+            inner_sizes[j] = vec[j].size();
+        }
+    }
+    MPI_Bcast(inner_sizes.data(), outer_size, MPI_INT, root, comm);
+
+    Inner window_buffer;
+    if (rank == root) {
+        window_buffer.reserve(nested_total_elements(vec));
+        for (const auto& inner : vec) {
+            window_buffer.insert(window_buffer.end(), inner.begin(), inner.end());
+        }
+        nested_count_copy(static_cast<long>(window_buffer.size()) * sizeof(T));
+    } else {
+        vec.resize(outer_size);
+        for (int j = 0; j < outer_size; j++) {
+            vec[j].resize(inner_sizes[j]);
+        }
+    }
+
+    MPI_Win win;
+    MPI_Win_create(window_buffer.data(), static_cast<MPI_Aint>(window_buffer.size()) * sizeof(T), sizeof(T),
+                   MPI_INFO_NULL, comm, &win);
+    MPI_Win_fence(0, win);
+    if (rank != root) {
+        MPI_Aint offset = 0;
+        for (int j = 0; j < outer_size; j++) {
+            if (inner_sizes[j] > 0) {
+                MPI_Get(vec[j].data(), inner_sizes[j], mpi_datatype<T>(), root, offset, inner_sizes[j],
+                        mpi_datatype<T>(), win);
+            }
+            offset += inner_sizes[j];
+        }
+    }
+    MPI_Win_fence(0, win);
+    MPI_Win_free(&win);
+}
+
+// Boost.MPI : sérialisation complète pour chaque destination
+template <typename Inner>
+void nested_boost(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    boost::mpi::communicator world(comm, boost::mpi::comm_attach);
+    if (world.rank() == root) {
+        for (int dest = 0; dest < world.size(); dest++) {
+            if (dest == root) continue;
+            world.send(dest, TAG_DATA, vec);
+            nested_count_copy(nested_total_elements(vec) * sizeof(T));
+        }
+    } else {
+        world.recv(root, TAG_DATA, vec);
+        nested_count_copy(nested_total_elements(vec) * sizeof(T));
+    }
+}
+
+// Boost.MPI : une seule sérialisation dans une archive, envoyée à chaque destination
+template <typename Inner>
+void nested_boost_packed(MPI_Comm comm, std::vector<Inner>& vec, int root) {
+    using T = typename Inner::value_type;
+    boost::mpi::communicator world(comm, boost::mpi::comm_attach);
+    if (world.rank() == root) {
+        boost::mpi::packed_oarchive oa(world);
+        oa << vec;
+        nested_count_copy(oa.size());
+        for (int dest = 0; dest < world.size(); dest++) {
+            if (dest == root) continue;
+            world.send(dest, TAG_DATA, oa);
+        }
+    } else {
+        boost::mpi::packed_iarchive ia(world);
+        world.recv(root, TAG_DATA, ia);
+        ia >> vec;
+        nested_count_copy(nested_total_elements(vec) * sizeof(T));
+    }
+}
+
+template <typename Inner>
+using BasicNestedStrategyFn = void (*)(MPI_Comm, std::vector<Inner>&, int);
+
+template <typename Inner>
+BasicNestedStrategyFn<Inner> nested_strategy_fn(int strategy) {
+    switch (strategy) {
+        case NESTED_RAW: return nested_raw<Inner>;
+        case NESTED_BCAST: return nested_bcast<Inner>;
+        case NESTED_PACK: return nested_pack<Inner>;
+        case NESTED_BINOMIAL: return nested_binomial<Inner>;
+        case NESTED_CHAIN: return nested_chain<Inner>;
+        case NESTED_SCATTER_ALLGATHER: return nested_scatter_allgather<Inner>;
+        case NESTED_RDMA: return nested_rdma<Inner>;
+        case NESTED_BOOST: return nested_boost<Inner>;
+        case NESTED_BOOST_PACKED: return nested_boost_packed<Inner>;
+        default: return nested_datatype<Inner>;
+    }
+}
+
+// ============================================================================
+// API broadcast_nested() - choix de la stratégie selon la taille du payload
+// La table de réglage associe des plages de taille (octets) à la stratégie la
+// plus rapide. Par défaut : le tableau de la conclusion du README ; sinon mesurée
+// par calibrate_nested_tuning() ou relue depuis un fichier de réglage.
+// Format du fichier : une ligne "<max_bytes> <strategy_name>" par plage, bornes
+// strictement croissantes, plus une ligne optionnelle "extrapolated_above <bytes>"
+// donnant la plus grande taille réellement mesurée.
+// ============================================================================
+class NestedTuning {
+public:
+    // (borne supérieure incluse en octets, stratégie) ; la dernière plage couvre le reste
+    std::vector<std::pair<long, int>> ranges;
+    // Plus grande taille mesurée : au-delà, la dernière plage est extrapolée
+    long measured_max = std::numeric_limits<long>::max();
+
+    // Fusionne avec la plage précédente si la stratégie est la même
+    void add(long max_bytes, int strategy) {
+        if (!ranges.empty() && ranges.back().second == strategy) {
+            ranges.back().first = max_bytes;
+        } else {
+            ranges.emplace_back(max_bytes, strategy);
+        }
+    }
+
+    int pick(long bytes) const {
+        for (const auto& range : ranges) {
+            if (bytes <= range.first) return range.second;
+        }
+        return ranges.empty() ? NESTED_DATATYPE : ranges.back().second;
+    }
+
+    bool extrapolated(long bytes) const { return bytes > measured_max; }
+
+    // Collectif : rank 0 lit le fichier puis diffuse la table. false si illisible,
+    // si une stratégie est inconnue ou si les bornes ne sont pas croissantes.
+    bool load(const std::string& path, MPI_Comm comm) {
+        int rank;
+        MPI_Comm_rank(comm, &rank);
+        std::vector<long> bounds;
+        std::vector<int> strategies;
+        long measured = std::numeric_limits<long>::max();
+        int count = -1;
+        if (rank == 0) {
+            std::ifstream in(path);
+            std::string key, value;
+            bool valid = static_cast<bool>(in);
+            while (valid && in >> key >> value) {
+                try {
+                    if (key == "extrapolated_above") {
+                        measured = std::stol(value);
+                        continue;
+                    }
+                    long max_bytes = std::stol(key);
+                    auto it = std::find(nested_strategy_names, nested_strategy_names + NESTED_STRATEGY_COUNT, value);
+                    valid = it != nested_strategy_names + NESTED_STRATEGY_COUNT &&
+                            (bounds.empty() || max_bytes > bounds.back());
+                    bounds.push_back(max_bytes);
+                    strategies.push_back(it - nested_strategy_names);
+                } catch (const std::exception&) {
+                    valid = false;
+                }
+            }
+            if (valid && !bounds.empty()) count = bounds.size();
+        }
+        MPI_Bcast(&count, 1, MPI_INT, 0, comm);
+        if (count < 0) return false;
+        bounds.resize(count);
+        strategies.resize(count);
+        MPI_Bcast(bounds.data(), count, MPI_LONG, 0, comm);
+        MPI_Bcast(strategies.data(), count, MPI_INT, 0, comm);
+        MPI_Bcast(&measured, 1, MPI_LONG, 0, comm);
+        ranges.clear();
+        for (int i = 0; i < count; i++) {
+            add(bounds[i], strategies[i]);
+        }
+        measured_max = measured;
+        return true;
+    }
+
+    // Écrit la table (rank 0 uniquement)
+    bool save(const std::string& path) const {
+        std::ofstream out(path);
+        for (const auto& range : ranges) {
+            out << range.first << " " << nested_strategy_names[range.second] << "\n";
+        }
+        if (measured_max != std::numeric_limits<long>::max()) {
+            out << "extrapolated_above " << measured_max << "\n";
+        }
+        return static_cast<bool>(out);
+    }
+};
+
+// Table par défaut, mesurée jusqu'à ~420 Mo (configurations du README)
+inline const NestedTuning& default_nested_tuning() {
+    static const NestedTuning tuning = [] {
+        NestedTuning table;
+        table.add(100L * 1024, NESTED_PACK);
+        table.add(100L * 1024 * 1024, NESTED_DATATYPE);
+        table.add(std::numeric_limits<long>::max(), NESTED_RAW);
+        return table;
+    }();
+    return tuning;
+}
+
+// Le root choisit la stratégie d'après la taille totale et la diffuse (1 int) :
+// les receveurs ne connaissent pas la taille avant l'appel
+template <typename Inner>
+void broadcast_nested(MPI_Comm comm, std::vector<Inner>& vec, int root,
+                      const NestedTuning& tuning = default_nested_tuning()) {
+    using T = typename Inner::value_type;
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    int strategy = 0;
+    if (rank == root) {
+        strategy = tuning.pick(nested_total_elements(vec) * static_cast<long>(sizeof(T)));
+    }
+    MPI_Bcast(&strategy, 1, MPI_INT, root, comm);
+    nested_strategy_fn<Inner>(strategy)(comm, vec, root);
+}
+
+// Courte campagne de mesure : tailles de 1 KiB à max_bytes (x4), forme 5 vecteurs
+// de ratio 25:1 comme les configurations du benchmark ; chaque stratégie est
+// répétée `reps` fois et la plus rapide (max sur les ranks) gagne. Les bornes entre
+// deux tailles mesurées sont placées à leur moyenne géométrique ; au-delà de la
+// dernière taille mesurée, la table est marquée extrapolée (measured_max).
+// Collectif sur `comm`.
+template <typename Inner = std::vector<int>>
+NestedTuning calibrate_nested_tuning(MPI_Comm comm, long max_bytes = 16L * 1024 * 1024, int reps = 3) {
+    using T = typename Inner::value_type;
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    NestedTuning tuning;
+    for (long bytes = 1024; bytes <= max_bytes; bytes *= 4) {
+        long base = std::max<long>(1, bytes / (55 * sizeof(T)));  // 1+4+9+16+25 = 55
+        std::vector<Inner> vec(5);
+        for (int i = 0; i < 5; i++) {
+            vec[i].resize(base * (i + 1) * (i + 1));
+        }
+        int best = 0;
+        double best_time = std::numeric_limits<double>::max();
+        for (int strategy = 0; strategy < NESTED_STRATEGY_COUNT; strategy++) {
+            BasicNestedStrategyFn<Inner> fn = nested_strategy_fn<Inner>(strategy);
+            MPI_Barrier(comm);
+            double start = MPI_Wtime();
+            for (int rep = 0; rep < reps; rep++) {
+                if (rank == 0) {
+                    fn(comm, vec, 0);
+                } else {
+                    std::vector<Inner> recv_vec;
+                    fn(comm, recv_vec, 0);
+                }
+            }
+            double elapsed = MPI_Wtime() - start;
+            double max_elapsed;
+            MPI_Allreduce(&elapsed, &max_elapsed, 1, MPI_DOUBLE, MPI_MAX, comm);
+            if (max_elapsed < best_time) {
+                best_time = max_elapsed;
+                best = strategy;
+            }
+        }
+        long bound = bytes * 4 <= max_bytes ? static_cast<long>(bytes * 2) : std::numeric_limits<long>::max();
+        tuning.add(bound, best);
+        tuning.measured_max = bytes;
+    }
+    return tuning;
+}
+
+#endif  // NESTED_BROADCAST_HPP